@@ -0,0 +1,61 @@
+﻿#include "assets.h"
+
+#ifdef _MSC_VER
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include "resource.h"
+
+// Ресурс RCDATA исполняемого файла; ресурсы отображены в память вместе с модулем, копирования нет
+struct EmbeddedFile {
+    const unsigned char* data;
+    std::size_t size;
+};
+
+static EmbeddedFile resourceFile(int id) {
+    HRSRC resource = FindResource(nullptr, MAKEINTRESOURCE(id), RT_RCDATA);
+    HGLOBAL handle = resource ? LoadResource(nullptr, resource) : nullptr;
+    if (!handle) {
+        return EmbeddedFile{ nullptr, 0 };
+    }
+    return EmbeddedFile{ static_cast<const unsigned char*>(LockResource(handle)), SizeofResource(nullptr, resource) };
+}
+
+#define EMBED_ASSET(name, resourceId, path) \
+    static const EmbeddedFile name##_file = resourceFile(resourceId); \
+    const unsigned char* const name = name##_file.data; \
+    const std::size_t name##_size = name##_file.size;
+
+#else
+
+#ifdef __APPLE__
+#define ASSET_SECTION ".const_data\n"
+#define ASSET_SYMBOL(name) "_" #name
+#else
+#define ASSET_SECTION ".section .rodata\n"
+#define ASSET_SYMBOL(name) #name
+#endif
+
+// Путь в .incbin ищется от каталога компиляции и в каталогах -Wa,-I
+#define EMBED_ASSET(name, resourceId, path) \
+    __asm__(ASSET_SECTION ".balign 16\n.global " ASSET_SYMBOL(name##_begin) "\n" ASSET_SYMBOL(name##_begin) ":\n" \
+        ".incbin \"" path "\"\n.global " ASSET_SYMBOL(name##_end) "\n" ASSET_SYMBOL(name##_end) ":\n.byte 0\n.text\n"); \
+    extern "C" const unsigned char name##_begin[]; \
+    extern "C" const unsigned char name##_end[]; \
+    const unsigned char* const name = name##_begin; \
+    const std::size_t name##_size = static_cast<std::size_t>(name##_end - name##_begin);
+
+#endif
+
+EMBED_ASSET(font_h, IDR_FONT, "Assets/font.ttf")
+EMBED_ASSET(ico_h, IDR_ICON_PNG, "Assets/icon.png")
+EMBED_ASSET(settings_h, IDR_SETTINGS, "Assets/settings.png")
+EMBED_ASSET(mortar_yellow, IDR_MORTAR_YELLOW, "Assets/mortar_yellow.png")
+EMBED_ASSET(mortar_green, IDR_MORTAR_GREEN, "Assets/mortar_green.png")
+EMBED_ASSET(mortar_red, IDR_MORTAR_RED, "Assets/mortar_red.png")
+EMBED_ASSET(mortar_blue, IDR_MORTAR_BLUE, "Assets/mortar_blue.png")
+EMBED_ASSET(target_yellow, IDR_TARGET_YELLOW, "Assets/target_yellow.png")
+EMBED_ASSET(target_green, IDR_TARGET_GREEN, "Assets/target_green.png")
+EMBED_ASSET(target_red, IDR_TARGET_RED, "Assets/target_red.png")
+EMBED_ASSET(target_blue, IDR_TARGET_BLUE, "Assets/target_blue.png")
@@ -0,0 +1,34 @@
+﻿#pragma once
+
+// Шрифт и иконки, встроенные в исполняемый файл. Исходные файлы лежат в Assets/ и подключаются
+// при сборке без преобразования в исходный текст: в MSVC - ресурсами RCDATA (MortarGUI1.rc),
+// в GCC и Clang - директивой ассемблера .incbin. Данные действительны с начала main.
+
+#include <cstddef>
+
+extern const unsigned char* const font_h;
+extern const std::size_t font_h_size;
+
+extern const unsigned char* const ico_h;
+extern const std::size_t ico_h_size;
+
+extern const unsigned char* const settings_h;
+extern const std::size_t settings_h_size;
+
+extern const unsigned char* const mortar_yellow;
+extern const std::size_t mortar_yellow_size;
+extern const unsigned char* const mortar_green;
+extern const std::size_t mortar_green_size;
+extern const unsigned char* const mortar_red;
+extern const std::size_t mortar_red_size;
+extern const unsigned char* const mortar_blue;
+extern const std::size_t mortar_blue_size;
+
+extern const unsigned char* const target_yellow;
+extern const std::size_t target_yellow_size;
+extern const unsigned char* const target_green;
+extern const std::size_t target_green_size;
+extern const unsigned char* const target_red;
+extern const std::size_t target_red_size;
+extern const unsigned char* const target_blue;
+extern const std::size_t target_blue_size;
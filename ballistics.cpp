@@ -0,0 +1,28 @@
+﻿#include "ballistics.h"
+
+#include <cmath>
+
+// Узлы таблиц проверены в ballistics.h; здесь проверяем, что интерполяция сворачивается при компиляции
+static_assert(interpolateAngle(80.0f) == 1574.0f, "interpolateAngle must fold to the first table value");
+static_assert(interpolateAngle(1500.0f) == 801.0f, "interpolateAngle must fold to the last table value");
+static_assert(convertAngleToAlternative(800.0f) == 45.0f, "convertAngleToAlternative must fold at compile time");
+
+// Функция для линейной интерполяции
+float interpolate(float x, const std::vector<float>& xVals, const std::vector<float>& yVals) {
+    std::size_t hint = 0;
+    return interpolateSearch(x, xVals, yVals, hint);
+}
+
+// Функция для вычисления дистанции между двумя точками
+float calculateDistance(const MapPoint& point1, const MapPoint& point2, float scale) {
+    float dx = (point2.x - point1.x) * scale;
+    float dy = (point2.y - point1.y) * scale;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+// Функция для вычисления азимута между двумя точками
+float calculateAzimuth(const MapPoint& point1, const MapPoint& point2) {
+    float angle = std::atan2(point2.x - point1.x, point1.y - point2.y) * 180 / pi;
+    if (angle < 0) angle += 360;
+    return angle;
+}
@@ -0,0 +1,319 @@
+﻿#pragma once
+
+// Баллистическое ядро калькулятора. Не зависит от SFML и карт,
+// поэтому его можно подключать отдельно от GUI (статическая библиотека Ballistics).
+// Таблицы стрельбы и интерполяция по ним constexpr: для констант угол считается при компиляции.
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Точка на карте в пикселях
+struct MapPoint {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+// Таблица стрельбы: узлы x и значения y одинаковой длины
+template <std::size_t N>
+struct FiringTable {
+    static_assert(N >= 2, "Firing table needs at least two points");
+
+    std::array<float, N> x;
+    std::array<float, N> y;
+
+    static constexpr std::size_t size() { return N; }
+
+    // Узлы x строго возрастают
+    constexpr bool isStrictlyIncreasing() const {
+        for (std::size_t i = 1; i < N; ++i) {
+            if (!(x[i - 1] < x[i])) return false;
+        }
+        return true;
+    }
+
+    // Все узлы и значения лежат в допустимых пределах
+    constexpr bool isInRange(float minX, float maxX, float minY, float maxY) const {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (x[i] < minX || x[i] > maxX || y[i] < minY || y[i] > maxY) return false;
+        }
+        return true;
+    }
+};
+
+// Создание таблицы стрельбы из двух списков; длины проверяются при компиляции
+template <std::size_t N, std::size_t M>
+constexpr FiringTable<N> makeFiringTable(const float (&x)[N], const float (&y)[M]) {
+    static_assert(N == M, "Firing table x and y must have the same length");
+    FiringTable<N> table{};
+    for (std::size_t i = 0; i < N; ++i) {
+        table.x[i] = x[i];
+        table.y[i] = y[i];
+    }
+    return table;
+}
+
+// Угол (тысячные) от дистанции (м)
+inline constexpr auto angleTable = makeFiringTable(
+    { 80, 90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200, 210, 230, 250, 260, 280, 300, 320, 330, 350, 380, 400, 430, 450, 480, 500, 530, 550, 580, 600, 630, 650, 680, 700, 730, 750, 780, 800, 830, 850, 880, 900, 930, 950, 980, 1000, 1030, 1050, 1080, 1100, 1130, 1150, 1170, 1180, 1190, 1200, 1210, 1220, 1230, 1240, 1250, 1260, 1270, 1280, 1290, 1300, 1310, 1320, 1330, 1340, 1350, 1360, 1370, 1380, 1390, 1400, 1410, 1420, 1430, 1440, 1450, 1460, 1470, 1480, 1490, 1500 },
+    { 1574, 1570, 1567, 1564, 1560, 1557, 1553, 1550, 1546, 1543, 1540, 1536, 1533, 1529, 1522, 1516, 1512, 1505, 1498, 1491, 1488, 1481, 1470, 1463, 1453, 1446, 1435, 1428, 1417, 1410, 1399, 1391, 1380, 1373, 1361, 1354, 1342, 1334, 1322, 1314, 1302, 1294, 1282, 1273, 1260, 1252, 1238, 1229, 1215, 1206, 1192, 1182, 1166, 1156, 1145, 1140, 1134, 1129, 1123, 1117, 1111, 1105, 1099, 1093, 1087, 1080, 1074, 1067, 1060, 1053, 1046, 1038, 1031, 1023, 1014, 1006, 997, 988, 978, 968, 957, 945, 933, 919, 903, 884, 860, 801 });
+static_assert(angleTable.isStrictlyIncreasing(), "Angle table distances must be strictly increasing");
+static_assert(angleTable.isInRange(0.0f, 2000.0f, 0.0f, 1600.0f), "Angle table values out of range");
+
+// Альт. ед. (градусы) от угла (тысячные)
+inline constexpr auto alternativeTable = makeFiringTable(
+    { 800, 817.4, 835, 852.5, 870, 890, 906.5, 925, 941, 960, 976.5, 995, 1012.5, 1030, 1048, 1065, 1083, 1101.5, 1120, 1136.5, 1155, 1173, 1192, 1208, 1226, 1244, 1262, 1280, 1298, 1315, 1332.5, 1350.5, 1368, 1387, 1404.5, 1422.5, 1440, 1457, 1475, 1492.5, 1510, 1527.5, 1546, 1556, 1565, 1574 },
+    { 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,87.5, 88, 88.3 });
+static_assert(alternativeTable.isStrictlyIncreasing(), "Alternative table angles must be strictly increasing");
+static_assert(alternativeTable.isInRange(0.0f, 1600.0f, 0.0f, 90.0f), "Alternative table values out of range");
+
+// Время полета (с) от дистанции (м). Таблица приблизительная: замеров нет, две точки взяты
+// из подсказки HUD "19-21с". Поэтому время по ней выводится с точностью до секунды и знаком "~";
+// профили с измеренной кривой загружаются через WeaponRegistry.
+inline constexpr auto flightTable = makeFiringTable(
+    { 80, 1500 },
+    { 21, 19 });
+static_assert(flightTable.isStrictlyIncreasing(), "Flight table distances must be strictly increasing");
+static_assert(flightTable.isInRange(0.0f, 2000.0f, 0.0f, 120.0f), "Flight table values out of range");
+
+// Данные для интерполяции дистанции
+inline constexpr const auto& distances = angleTable.x;
+inline constexpr const auto& angles = angleTable.y;
+
+// Данные для интерполяции наклона
+inline constexpr const auto& alternativeAngles = alternativeTable.x;
+inline constexpr const auto& alternativeUnits = alternativeTable.y;
+
+// Интерполяция внутри сегмента [i - 1, i]
+template <typename XTable, typename YTable>
+constexpr float interpolateSegment(float x, const XTable& xVals, const YTable& yVals, std::size_t i) {
+    float t = (x - xVals[i - 1]) / (xVals[i] - xVals[i - 1]);
+    return yVals[i - 1] + t * (yVals[i] - yVals[i - 1]);
+}
+
+// Ядро линейной интерполяции по таблице с неравномерным шагом.
+// Сегмент ищется безветвленным бинарным поиском по узлам xVals; hint хранит найденный
+// сегмент, и при монотонных запросах следующий вызов проверяет его (и соседний) без поиска.
+// Результат совпадает с interpolateLinear для любых x, включая NaN и выход за границы (проверяет ballistics_test).
+template <typename XTable, typename YTable>
+constexpr float interpolateSearch(float x, const XTable& xVals, const YTable& yVals, std::size_t& hint) {
+    const std::size_t count = xVals.size();
+    std::size_t i = 0;
+    if (hint >= 1 && hint < count && x <= xVals[hint] && (hint == 1 || xVals[hint - 1] < x)) {
+        i = hint;
+    }
+    else if (hint >= 1 && hint + 1 < count && xVals[hint] < x && x <= xVals[hint + 1]) {
+        i = hint + 1;
+    }
+    else {
+        const float* base = xVals.data() + 1;
+        std::size_t length = count - 1;
+        while (length > 1) {
+            std::size_t half = length / 2;
+            base = (base[half] < x) ? base + half : base;
+            length -= half;
+        }
+        i = static_cast<std::size_t>(base - xVals.data()) + (*base < x);
+    }
+    if (i >= count || !(x <= xVals[i])) {
+        return yVals[count - 1];
+    }
+    hint = i;
+    return interpolateSegment(x, xVals, yVals, i);
+}
+
+// Эталонная линейная интерполяция с последовательным перебором узлов
+template <typename XTable, typename YTable>
+constexpr float interpolateLinear(float x, const XTable& xVals, const YTable& yVals) {
+    for (std::size_t i = 1; i < xVals.size(); ++i) {
+        if (x <= xVals[i]) {
+            return interpolateSegment(x, xVals, yVals, i);
+        }
+    }
+    return yVals[yVals.size() - 1];
+}
+
+// Функция для линейной интерполяции
+float interpolate(float x, const std::vector<float>& xVals, const std::vector<float>& yVals);
+
+// Таблица без владения данными, например узлы профиля, загруженного во время работы
+struct TableView {
+    const float* values = nullptr;
+    std::size_t count = 0;
+
+    constexpr const float* data() const { return values; }
+    constexpr std::size_t size() const { return count; }
+    constexpr float operator[](std::size_t i) const { return values[i]; }
+};
+
+// Равномерная таблица: values[i] - значение в точке first + i * step
+struct UniformLookup {
+    const float* values = nullptr;
+    std::size_t count = 0;
+    float first = 0.0f;
+    float step = 1.0f;
+};
+
+// Заполнение равномерной таблицы одним проходом по сегментам xVals/yVals.
+// Значения в узлах совпадают с interpolateLinear.
+template <typename XTable, typename YTable, typename Lookup>
+constexpr void fillUniformLookup(const XTable& xVals, const YTable& yVals, float first, float step, Lookup& lookup) {
+    std::size_t segment = 1;
+    for (std::size_t i = 0; i < lookup.size(); ++i) {
+        float x = first + static_cast<float>(i) * step;
+        while (segment < xVals.size() && !(x <= xVals[segment])) {
+            ++segment;
+        }
+        lookup[i] = segment < xVals.size() ? interpolateSegment(x, xVals, yVals, segment) : yVals[yVals.size() - 1];
+    }
+}
+
+// Интерполяция по равномерной таблице: индекс и линейная интерполяция.
+// Ниже first продолжает первый сегмент, выше последнего узла возвращает последнее значение.
+constexpr float interpolateUniform(float x, const UniformLookup& lookup) {
+    float position = (x - lookup.first) / lookup.step;
+    if (!(position < static_cast<float>(lookup.count - 1))) {
+        return lookup.values[lookup.count - 1];
+    }
+    std::size_t index = position > 0.0f ? static_cast<std::size_t>(position) : 0;
+    float t = position - static_cast<float>(index);
+    return lookup.values[index] + t * (lookup.values[index + 1] - lookup.values[index]);
+}
+
+// Границы и шаг равномерной таблицы угла (м). Все узлы distances лежат на этой сетке,
+// поэтому таблица воспроизводит кусочно-линейную интерполяцию без потери точности.
+// Допустимое отклонение от interpolateLinear - angleLookupMaxError тысячных (проверяет ballistics_test).
+constexpr float angleLookupMinDistance = 80.0f;
+constexpr float angleLookupMaxDistance = 1500.0f;
+constexpr float angleLookupStep = 1.0f;
+constexpr std::size_t angleLookupSize = static_cast<std::size_t>((angleLookupMaxDistance - angleLookupMinDistance) / angleLookupStep) + 1;
+constexpr float angleLookupMaxError = 0.05f;
+
+// Равномерная таблица угла миномета, строится при компиляции
+constexpr std::array<float, angleLookupSize> buildAngleLookup() {
+    std::array<float, angleLookupSize> lookup{};
+    fillUniformLookup(distances, angles, angleLookupMinDistance, angleLookupStep, lookup);
+    return lookup;
+}
+
+inline constexpr auto angleLookup = buildAngleLookup();
+
+// Функция для интерполяции угла
+constexpr float interpolateAngle(float distance) {
+    return interpolateUniform(distance, UniformLookup{ angleLookup.data(), angleLookupSize, angleLookupMinDistance, angleLookupStep });
+}
+
+// Равномерная таблица времени полета на той же сетке, что и таблица угла
+constexpr std::array<float, angleLookupSize> buildFlightLookup() {
+    std::array<float, angleLookupSize> lookup{};
+    fillUniformLookup(flightTable.x, flightTable.y, angleLookupMinDistance, angleLookupStep, lookup);
+    return lookup;
+}
+
+inline constexpr auto flightLookup = buildFlightLookup();
+
+// Время полета (с) по дистанции: тот же быстрый путь, что у interpolateAngle
+constexpr float interpolateTimeOfFlight(float distance) {
+    return interpolateUniform(distance, UniformLookup{ flightLookup.data(), angleLookupSize, angleLookupMinDistance, angleLookupStep });
+}
+
+// Функция для преобразования угла в альт. ед.
+constexpr float convertAngleToAlternative(float angle) {
+    std::size_t hint = 0;
+    return interpolateSearch(angle, alternativeAngles, alternativeUnits, hint);
+}
+
+// Число пи (азимут раньше считался с усеченным 3.14159)
+constexpr float pi = 3.14159265358979f;
+
+// Коэффициенты минимаксного полинома atan(z) для z в [0, 1] (только нечетные степени)
+constexpr float atanCoefficients[6] = { 0.99997726f, -0.33262347f, 0.19354346f, -0.11643287f, 0.05265332f, -0.01172120f };
+
+// Граница погрешности fastAtan2 и fastAtan2Batch на всем круге (градусы; 2e-6 рад), проверяет ballistics_test
+constexpr float fastAtan2MaxError = 1.2e-4f;
+
+// Быстрый atan2 (радианы) на полиноме. Погрешность не более fastAtan2MaxError на всем круге,
+// что на три порядка меньше точности вывода азимута (0.1 градуса). Без ветвлений по данным,
+// поэтому компилятор может векторизовать циклы с ним; явная SIMD-версия - fastAtan2Batch.
+inline float fastAtan2(float y, float x) {
+    float absX = std::fabs(x);
+    float absY = std::fabs(y);
+    float maxValue = absX > absY ? absX : absY;
+    float minValue = absX > absY ? absY : absX;
+    float z = maxValue > 0.0f ? minValue / maxValue : 0.0f;
+    float z2 = z * z;
+    float polynomial = atanCoefficients[5];
+    for (int i = 4; i >= 0; --i) {
+        polynomial = polynomial * z2 + atanCoefficients[i];
+    }
+    float result = z * polynomial;
+    result = absY > absX ? pi / 2 - result : result;
+    result = x < 0.0f ? pi - result : result;
+    return std::copysign(result, y);
+}
+
+// Пакетный atan2(y[i], x[i]) в радианах (AVX2/SSE2, скалярный вариант на остальных платформах)
+void fastAtan2Batch(const float* y, const float* x, float* out, std::size_t count);
+
+// Функция для вычисления дистанции между двумя точками
+float calculateDistance(const MapPoint& point1, const MapPoint& point2, float scale);
+
+// Функция для вычисления азимута между двумя точками
+float calculateAzimuth(const MapPoint& point1, const MapPoint& point2);
+
+// Таблицы, по которым работает решатель: равномерные таблицы угла и времени полета, таблица альт. ед.
+struct SolverTables {
+    UniformLookup angle;
+    TableView alternativeAngles;
+    TableView alternativeUnits;
+    UniformLookup flight;
+};
+
+// Таблицы миномета PR
+constexpr SolverTables mortarSolverTables() {
+    return SolverTables{
+        UniformLookup{ angleLookup.data(), angleLookupSize, angleLookupMinDistance, angleLookupStep },
+        TableView{ alternativeAngles.data(), alternativeAngles.size() },
+        TableView{ alternativeUnits.data(), alternativeUnits.size() },
+        UniformLookup{ flightLookup.data(), angleLookupSize, angleLookupMinDistance, angleLookupStep }
+    };
+}
+
+// Входные данные пакетного расчета: массивы координат (структура массивов) длиной count
+struct FiringBatchInput {
+    const float* mortarX = nullptr;
+    const float* mortarY = nullptr;
+    const float* targetX = nullptr;
+    const float* targetY = nullptr;
+    std::size_t count = 0;
+    float mapScale = 1.0f;
+};
+
+// Результаты пакетного расчета: дистанция (м), азимут (градусы, через fastAtan2), угол (тысячные), альт. ед.
+// и время полета (с); timeOfFlight можно не задавать
+struct FiringBatchOutput {
+    float* distance = nullptr;
+    float* azimuth = nullptr;
+    float* angle = nullptr;
+    float* alternative = nullptr;
+    float* timeOfFlight = nullptr;
+};
+
+// Пакетный расчет для пар миномет-цель (AVX2 по CPUID, SSE2, скалярный вариант на остальных платформах).
+// Результаты побитно совпадают с calculateDistance, interpolateUniform и fastAtan2, пока компилятор
+// не сжимает a * b + c в FMA: CMake собирает библиотеку с -ffp-contract=off, MSVC 2022 без /fp:contract не сжимает.
+void solveFiringBatch(const SolverTables& tables, const FiringBatchInput& input, const FiringBatchOutput& output);
+void solveFiringBatch(const FiringBatchInput& input, const FiringBatchOutput& output);
+
+// Расчет для всех минометов по всем целям; результаты по строкам: миномет * targetCount + цель
+void solveFiringGrid(const SolverTables& tables, const float* mortarX, const float* mortarY, std::size_t mortarCount,
+    const float* targetX, const float* targetY, std::size_t targetCount, float mapScale, const FiringBatchOutput& output);
+void solveFiringGrid(const float* mortarX, const float* mortarY, std::size_t mortarCount,
+    const float* targetX, const float* targetY, std::size_t targetCount, float mapScale, const FiringBatchOutput& output);
+
+// Пакетная интерполяция по равномерной таблице
+void interpolateUniformBatch(const UniformLookup& lookup, const float* x, float* out, std::size_t count);
+
+// Пакетное время полета по дистанциям, например для всех целей в очереди
+void timeOfFlightBatch(const SolverTables& tables, const float* distances, float* times, std::size_t count);
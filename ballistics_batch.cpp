@@ -0,0 +1,238 @@
+﻿#include "ballistics.h"
+#include "ballistics_simd.h"
+
+#include <cmath>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+// Азимут пакетного расчета: как calculateAzimuth, но через fastAtan2
+static float fastAzimuth(float mortarX, float mortarY, float targetX, float targetY) {
+    float angle = fastAtan2(targetX - mortarX, mortarY - targetY) * degreesPerRadian;
+    return angle < 0.0f ? angle + 360.0f : angle;
+}
+
+// Скалярный расчет пар [first, last); mortarStride = 0 означает один миномет на все цели
+static void solveScalar(const float* mortarX, const float* mortarY, std::size_t mortarStride, const float* targetX, const float* targetY,
+    float mapScale, std::size_t first, std::size_t last, const SolverTables& tables, const FiringBatchOutput& output, std::size_t& alternativeHint) {
+    for (std::size_t i = first; i < last; ++i) {
+        float mx = mortarX[i * mortarStride];
+        float my = mortarY[i * mortarStride];
+        float distance = calculateDistance(MapPoint{ mx, my }, MapPoint{ targetX[i], targetY[i] }, mapScale);
+        output.distance[i] = distance;
+        output.angle[i] = interpolateUniform(distance, tables.angle);
+        if (output.timeOfFlight && tables.flight.count) {
+            output.timeOfFlight[i] = interpolateUniform(distance, tables.flight);
+        }
+        output.azimuth[i] = fastAzimuth(mx, my, targetX[i], targetY[i]);
+        output.alternative[i] = interpolateSearch(output.angle[i], tables.alternativeAngles, tables.alternativeUnits, alternativeHint);
+    }
+}
+
+#if defined(BALLISTICS_SSE2)
+
+// Выбор по маске без SSE4.1 blendv
+static __m128 select(__m128 mask, __m128 ifTrue, __m128 ifFalse) {
+    return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+
+// atan2 для 4 значений; та же схема, что у fastAtan2
+static __m128 fastAtan2Vector(__m128 y, __m128 x) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 absX = _mm_andnot_ps(signMask, x);
+    __m128 absY = _mm_andnot_ps(signMask, y);
+    __m128 maxValue = _mm_max_ps(absX, absY);
+    __m128 minValue = _mm_min_ps(absX, absY);
+    __m128 z = _mm_and_ps(_mm_div_ps(minValue, maxValue), _mm_cmpgt_ps(maxValue, _mm_setzero_ps()));
+    __m128 z2 = _mm_mul_ps(z, z);
+    __m128 polynomial = _mm_set1_ps(atanCoefficients[5]);
+    for (int i = 4; i >= 0; --i) {
+        polynomial = _mm_add_ps(_mm_mul_ps(polynomial, z2), _mm_set1_ps(atanCoefficients[i]));
+    }
+    __m128 result = _mm_mul_ps(z, polynomial);
+    result = select(_mm_cmpgt_ps(absY, absX), _mm_sub_ps(_mm_set1_ps(pi / 2), result), result);
+    result = select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(pi), result), result);
+    return _mm_or_ps(result, _mm_and_ps(y, signMask));
+}
+
+static std::size_t fastAtan2Vector(const float* y, const float* x, float* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, fastAtan2Vector(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
+    }
+    return i;
+}
+
+// Интерполяция по равномерной таблице для 4 значений: индекс векторно, выборка узлов скалярно
+static __m128 interpolateUniformVector(__m128 x, const UniformLookup& lookup) {
+    __m128 position = _mm_div_ps(_mm_sub_ps(x, _mm_set1_ps(lookup.first)), _mm_set1_ps(lookup.step));
+    __m128 inside = _mm_cmplt_ps(position, _mm_set1_ps(static_cast<float>(lookup.count - 1)));
+    alignas(16) float positions[4];
+    alignas(16) int indices[4];
+    alignas(16) float values[4];
+    _mm_store_ps(positions, position);
+    _mm_store_si128(reinterpret_cast<__m128i*>(indices), _mm_cvttps_epi32(_mm_and_ps(_mm_max_ps(position, _mm_setzero_ps()), inside)));
+    int insideMask = _mm_movemask_ps(inside);
+    for (int lane = 0; lane < 4; ++lane) {
+        values[lane] = lookup.values[lookup.count - 1];
+        if (insideMask & (1 << lane)) {
+            std::size_t index = static_cast<std::size_t>(indices[lane]);
+            float t = positions[lane] - static_cast<float>(index);
+            values[lane] = lookup.values[index] + t * (lookup.values[index + 1] - lookup.values[index]);
+        }
+    }
+    return _mm_load_ps(values);
+}
+
+static std::size_t interpolateUniformVector(const float* x, float* out, std::size_t count, const UniformLookup& lookup) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, interpolateUniformVector(_mm_loadu_ps(x + i), lookup));
+    }
+    return i;
+}
+
+// 4 пары за итерацию: дистанция, азимут, угол и время полета
+static std::size_t solveVector(const float* mortarX, const float* mortarY, std::size_t mortarStride, const float* targetX, const float* targetY,
+    float mapScale, std::size_t count, const SolverTables& tables, const FiringBatchOutput& output) {
+    const __m128 scale = _mm_set1_ps(mapScale);
+    const __m128 zero = _mm_setzero_ps();
+    const bool withFlight = output.timeOfFlight && tables.flight.count;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 mx = mortarStride ? _mm_loadu_ps(mortarX + i) : _mm_set1_ps(mortarX[0]);
+        __m128 my = mortarStride ? _mm_loadu_ps(mortarY + i) : _mm_set1_ps(mortarY[0]);
+        __m128 deltaX = _mm_sub_ps(_mm_loadu_ps(targetX + i), mx);
+        __m128 deltaY = _mm_sub_ps(my, _mm_loadu_ps(targetY + i));
+        __m128 dx = _mm_mul_ps(deltaX, scale);
+        __m128 dy = _mm_mul_ps(deltaY, scale);
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+        _mm_storeu_ps(output.distance + i, distance);
+
+        __m128 azimuth = _mm_mul_ps(fastAtan2Vector(deltaX, deltaY), _mm_set1_ps(degreesPerRadian));
+        azimuth = _mm_add_ps(azimuth, _mm_and_ps(_mm_set1_ps(360.0f), _mm_cmplt_ps(azimuth, zero)));
+        _mm_storeu_ps(output.azimuth + i, azimuth);
+
+        _mm_storeu_ps(output.angle + i, interpolateUniformVector(distance, tables.angle));
+        if (withFlight) {
+            _mm_storeu_ps(output.timeOfFlight + i, interpolateUniformVector(distance, tables.flight));
+        }
+    }
+    return i;
+}
+
+#else
+
+// Без SIMD весь пакет считается скалярно
+static std::size_t fastAtan2Vector(const float*, const float*, float*, std::size_t) {
+    return 0;
+}
+
+static std::size_t interpolateUniformVector(const float*, float*, std::size_t, const UniformLookup&) {
+    return 0;
+}
+
+static std::size_t solveVector(const float*, const float*, std::size_t, const float*, const float*, float, std::size_t, const SolverTables&, const FiringBatchOutput&) {
+    return 0;
+}
+
+#endif
+
+// Поддерживают ли процессор и ОС инструкции AVX2 (ОС должна сохранять регистры YMM)
+static bool cpuSupportsAvx2() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+// Векторные ядра, выбранные один раз при первом пакетном расчете
+struct BatchKernels {
+    std::size_t (*fastAtan2)(const float* y, const float* x, float* out, std::size_t count);
+    std::size_t (*interpolateUniform)(const float* x, float* out, std::size_t count, const UniformLookup& lookup);
+    std::size_t (*solve)(const float* mortarX, const float* mortarY, std::size_t mortarStride, const float* targetX, const float* targetY,
+        float mapScale, std::size_t count, const SolverTables& tables, const FiringBatchOutput& output);
+};
+
+static BatchKernels selectBatchKernels() {
+    if (avx2KernelsCompiled() && cpuSupportsAvx2()) {
+        return BatchKernels{ fastAtan2Avx2, interpolateUniformAvx2, solveAvx2 };
+    }
+    return BatchKernels{ fastAtan2Vector, interpolateUniformVector, solveVector };
+}
+
+static const BatchKernels& batchKernels() {
+    static const BatchKernels kernels = selectBatchKernels();
+    return kernels;
+}
+
+// Пакетный atan2(y[i], x[i]) в радианах
+void fastAtan2Batch(const float* y, const float* x, float* out, std::size_t count) {
+    for (std::size_t i = batchKernels().fastAtan2(y, x, out, count); i < count; ++i) {
+        out[i] = fastAtan2(y[i], x[i]);
+    }
+}
+
+// Пакетная интерполяция по равномерной таблице
+void interpolateUniformBatch(const UniformLookup& lookup, const float* x, float* out, std::size_t count) {
+    for (std::size_t i = batchKernels().interpolateUniform(x, out, count, lookup); i < count; ++i) {
+        out[i] = interpolateUniform(x[i], lookup);
+    }
+}
+
+// Пакетное время полета по дистанциям
+void timeOfFlightBatch(const SolverTables& tables, const float* distances, float* times, std::size_t count) {
+    interpolateUniformBatch(tables.flight, distances, times, count);
+}
+
+// Пакетный расчет: векторная часть, альт. ед. для нее и скалярный хвост
+static void solveBatch(const float* mortarX, const float* mortarY, std::size_t mortarStride, const float* targetX, const float* targetY,
+    float mapScale, std::size_t count, const SolverTables& tables, const FiringBatchOutput& output) {
+    std::size_t alternativeHint = 0;
+    std::size_t done = batchKernels().solve(mortarX, mortarY, mortarStride, targetX, targetY, mapScale, count, tables, output);
+    for (std::size_t i = 0; i < done; ++i) {
+        output.alternative[i] = interpolateSearch(output.angle[i], tables.alternativeAngles, tables.alternativeUnits, alternativeHint);
+    }
+    solveScalar(mortarX, mortarY, mortarStride, targetX, targetY, mapScale, done, count, tables, output, alternativeHint);
+}
+
+// Пакетный расчет для пар миномет-цель
+void solveFiringBatch(const SolverTables& tables, const FiringBatchInput& input, const FiringBatchOutput& output) {
+    solveBatch(input.mortarX, input.mortarY, 1, input.targetX, input.targetY, input.mapScale, input.count, tables, output);
+}
+
+void solveFiringBatch(const FiringBatchInput& input, const FiringBatchOutput& output) {
+    solveFiringBatch(mortarSolverTables(), input, output);
+}
+
+// Расчет для всех минометов по всем целям; результаты по строкам: миномет * targetCount + цель
+void solveFiringGrid(const SolverTables& tables, const float* mortarX, const float* mortarY, std::size_t mortarCount,
+    const float* targetX, const float* targetY, std::size_t targetCount, float mapScale, const FiringBatchOutput& output) {
+    for (std::size_t m = 0; m < mortarCount; ++m) {
+        std::size_t offset = m * targetCount;
+        FiringBatchOutput row{ output.distance + offset, output.azimuth + offset, output.angle + offset, output.alternative + offset,
+            output.timeOfFlight ? output.timeOfFlight + offset : nullptr };
+        solveBatch(mortarX + m, mortarY + m, 0, targetX, targetY, mapScale, targetCount, tables, row);
+    }
+}
+
+void solveFiringGrid(const float* mortarX, const float* mortarY, std::size_t mortarCount,
+    const float* targetX, const float* targetY, std::size_t targetCount, float mapScale, const FiringBatchOutput& output) {
+    solveFiringGrid(mortarSolverTables(), mortarX, mortarY, mortarCount, targetX, targetY, targetCount, mapScale, output);
+}
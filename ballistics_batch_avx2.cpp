@@ -0,0 +1,111 @@
+﻿// Ядра AVX2 пакетного решателя. Файл собирается с /arch:AVX2 (-mavx2), остальная библиотека - без,
+// а вызываются ядра только после проверки процессора (ballistics_batch.cpp).
+// Поэтому здесь нельзя вызывать inline-функции из заголовков: их копия с инструкциями AVX2
+// могла бы достаться при компоновке и остальному коду. Ядра используют только интринсики.
+
+#include "ballistics_simd.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+bool avx2KernelsCompiled() {
+    return true;
+}
+
+// atan2 для 8 значений; та же схема, что у fastAtan2
+static __m256 fastAtan2Vector(__m256 y, __m256 x) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    __m256 absX = _mm256_andnot_ps(signMask, x);
+    __m256 absY = _mm256_andnot_ps(signMask, y);
+    __m256 maxValue = _mm256_max_ps(absX, absY);
+    __m256 minValue = _mm256_min_ps(absX, absY);
+    __m256 z = _mm256_and_ps(_mm256_div_ps(minValue, maxValue), _mm256_cmp_ps(maxValue, _mm256_setzero_ps(), _CMP_GT_OQ));
+    __m256 z2 = _mm256_mul_ps(z, z);
+    __m256 polynomial = _mm256_set1_ps(atanCoefficients[5]);
+    for (int i = 4; i >= 0; --i) {
+        polynomial = _mm256_add_ps(_mm256_mul_ps(polynomial, z2), _mm256_set1_ps(atanCoefficients[i]));
+    }
+    __m256 result = _mm256_mul_ps(z, polynomial);
+    result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(pi / 2), result), _mm256_cmp_ps(absY, absX, _CMP_GT_OQ));
+    result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(pi), result), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+    return _mm256_or_ps(result, _mm256_and_ps(y, signMask));
+}
+
+std::size_t fastAtan2Avx2(const float* y, const float* x, float* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, fastAtan2Vector(_mm256_loadu_ps(y + i), _mm256_loadu_ps(x + i)));
+    }
+    return i;
+}
+
+// Интерполяция по равномерной таблице для 8 значений: индекс, gather соседних узлов и lerp
+static __m256 interpolateUniformVector(__m256 x, const UniformLookup& lookup) {
+    const __m256 zero = _mm256_setzero_ps();
+    __m256 position = _mm256_div_ps(_mm256_sub_ps(x, _mm256_set1_ps(lookup.first)), _mm256_set1_ps(lookup.step));
+    __m256 inside = _mm256_cmp_ps(position, _mm256_set1_ps(static_cast<float>(lookup.count - 1)), _CMP_LT_OQ);
+    __m256i index = _mm256_cvttps_epi32(_mm256_and_ps(_mm256_max_ps(position, zero), inside));
+    __m256 t = _mm256_sub_ps(position, _mm256_cvtepi32_ps(index));
+    __m256 a = _mm256_i32gather_ps(lookup.values, index, 4);
+    __m256 b = _mm256_i32gather_ps(lookup.values + 1, index, 4);
+    __m256 value = _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+    return _mm256_blendv_ps(_mm256_set1_ps(lookup.values[lookup.count - 1]), value, inside);
+}
+
+std::size_t interpolateUniformAvx2(const float* x, float* out, std::size_t count, const UniformLookup& lookup) {
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, interpolateUniformVector(_mm256_loadu_ps(x + i), lookup));
+    }
+    return i;
+}
+
+// 8 пар за итерацию: дистанция, азимут, угол и время полета
+std::size_t solveAvx2(const float* mortarX, const float* mortarY, std::size_t mortarStride, const float* targetX, const float* targetY,
+    float mapScale, std::size_t count, const SolverTables& tables, const FiringBatchOutput& output) {
+    const __m256 scale = _mm256_set1_ps(mapScale);
+    const __m256 zero = _mm256_setzero_ps();
+    const bool withFlight = output.timeOfFlight && tables.flight.count;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 mx = mortarStride ? _mm256_loadu_ps(mortarX + i) : _mm256_set1_ps(mortarX[0]);
+        __m256 my = mortarStride ? _mm256_loadu_ps(mortarY + i) : _mm256_set1_ps(mortarY[0]);
+        __m256 deltaX = _mm256_sub_ps(_mm256_loadu_ps(targetX + i), mx);
+        __m256 deltaY = _mm256_sub_ps(my, _mm256_loadu_ps(targetY + i));
+        __m256 dx = _mm256_mul_ps(deltaX, scale);
+        __m256 dy = _mm256_mul_ps(deltaY, scale);
+        __m256 distance = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+        _mm256_storeu_ps(output.distance + i, distance);
+
+        __m256 azimuth = _mm256_mul_ps(fastAtan2Vector(deltaX, deltaY), _mm256_set1_ps(degreesPerRadian));
+        azimuth = _mm256_add_ps(azimuth, _mm256_and_ps(_mm256_set1_ps(360.0f), _mm256_cmp_ps(azimuth, zero, _CMP_LT_OQ)));
+        _mm256_storeu_ps(output.azimuth + i, azimuth);
+
+        _mm256_storeu_ps(output.angle + i, interpolateUniformVector(distance, tables.angle));
+        if (withFlight) {
+            _mm256_storeu_ps(output.timeOfFlight + i, interpolateUniformVector(distance, tables.flight));
+        }
+    }
+    return i;
+}
+
+#else
+
+bool avx2KernelsCompiled() {
+    return false;
+}
+
+std::size_t fastAtan2Avx2(const float*, const float*, float*, std::size_t) {
+    return 0;
+}
+
+std::size_t interpolateUniformAvx2(const float*, float*, std::size_t, const UniformLookup&) {
+    return 0;
+}
+
+std::size_t solveAvx2(const float*, const float*, std::size_t, const float*, const float*, float, std::size_t, const SolverTables&, const FiringBatchOutput&) {
+    return 0;
+}
+
+#endif
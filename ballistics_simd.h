@@ -0,0 +1,22 @@
+﻿#pragma once
+
+// Векторные ядра пакетного решателя. SSE2 - базовый набор x86 и x64, его ядра собираются
+// в ballistics_batch.cpp. Ядра AVX2 лежат в ballistics_batch_avx2.cpp, который один собирается
+// с /arch:AVX2 (-mavx2), и выбираются во время работы, если процессор поддерживает AVX2.
+
+#include "ballistics.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BALLISTICS_SSE2 1
+#endif
+
+constexpr float degreesPerRadian = 180.0f / pi;
+
+// Ядра AVX2. Каждое обрабатывает начало массива кратно 8 и возвращает число обработанных элементов;
+// без AVX2 в сборке возвращают 0. solveAvx2 считает дистанцию, азимут, угол и время полета, альт. ед. - вызывающий.
+bool avx2KernelsCompiled();
+std::size_t fastAtan2Avx2(const float* y, const float* x, float* out, std::size_t count);
+std::size_t interpolateUniformAvx2(const float* x, float* out, std::size_t count, const UniformLookup& lookup);
+std::size_t solveAvx2(const float* mortarX, const float* mortarY, std::size_t mortarStride, const float* targetX, const float* targetY,
+    float mapScale, std::size_t count, const SolverTables& tables, const FiringBatchOutput& output);
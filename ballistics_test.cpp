@@ -0,0 +1,96 @@
+﻿// Проверки точности баллистического ядра; запускается ctest. Код возврата не 0, если хоть одна граница нарушена.
+
+#include "ballistics.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Отклонение interpolateAngle от кусочно-линейной интерполяции по distances/angles (в тысячных)
+static bool checkAngleLookup() {
+    float maxError = 0.0f;
+    for (float distance = angleLookupMinDistance - 10.0f; distance <= angleLookupMaxDistance + 10.0f; distance += 0.01f) {
+        float error = std::fabs(interpolateAngle(distance) - interpolateLinear(distance, distances, angles));
+        if (error > maxError) maxError = error;
+    }
+    if (maxError > angleLookupMaxError) {
+        std::cerr << "Angle lookup table deviates from firing table by " << maxError << " mil" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Сравнение результатов ядра (с подсказкой и без) с эталоном на одной таблице
+template <typename XTable, typename YTable>
+static std::size_t countMismatches(const XTable& xVals, const YTable& yVals) {
+    std::size_t mismatches = 0;
+    std::size_t hint = 0;
+    float first = xVals[0] - 20.0f;
+    float last = xVals[xVals.size() - 1] + 20.0f;
+    for (float x = first; x <= last; x += 0.05f) {
+        float expected = interpolateLinear(x, xVals, yVals);
+        std::size_t freshHint = 0;
+        if (interpolateSearch(x, xVals, yVals, hint) != expected || interpolateSearch(x, xVals, yVals, freshHint) != expected) {
+            ++mismatches;
+        }
+    }
+    for (float x : xVals) {
+        std::size_t freshHint = 0;
+        if (interpolateSearch(x, xVals, yVals, freshHint) != interpolateLinear(x, xVals, yVals)) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+// interpolateSearch совпадает с interpolateLinear на таблицах миномета
+static bool checkInterpolateSearch() {
+    std::size_t mismatches = countMismatches(distances, angles) + countMismatches(alternativeAngles, alternativeUnits);
+    if (mismatches != 0) {
+        std::cerr << "Binary search interpolation differs from linear interpolation in " << mismatches << " points" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Отклонение fastAtan2 и fastAtan2Batch от std::atan2 на полном круге (градусы)
+static bool checkFastAtan2() {
+    const double circle = 2.0 * 3.14159265358979323846;
+    const int steps = 3600 * 100;
+    std::vector<float> ys, xs;
+    for (int i = 0; i < steps; ++i) {
+        double direction = circle * i / steps;
+        for (float radius : { 0.5f, 37.0f, 900.0f }) {
+            ys.push_back(static_cast<float>(radius * std::sin(direction)));
+            xs.push_back(static_cast<float>(radius * std::cos(direction)));
+        }
+    }
+    std::vector<float> batch(ys.size());
+    fastAtan2Batch(ys.data(), xs.data(), batch.data(), ys.size());
+
+    double maxError = 0.0, maxBatchError = 0.0;
+    for (std::size_t i = 0; i < ys.size(); ++i) {
+        double expected = std::atan2(static_cast<double>(ys[i]), static_cast<double>(xs[i]));
+        double error = std::fabs(fastAtan2(ys[i], xs[i]) - expected);
+        double batchError = std::fabs(batch[i] - expected);
+        if (error > circle / 2) error = circle - error;
+        if (batchError > circle / 2) batchError = circle - batchError;
+        if (error > maxError) maxError = error;
+        if (batchError > maxBatchError) maxBatchError = batchError;
+    }
+    maxError *= 360.0 / circle;
+    maxBatchError *= 360.0 / circle;
+    if (maxError > fastAtan2MaxError || maxBatchError > fastAtan2MaxError) {
+        std::cerr << "Fast atan2 error " << maxError << " deg (batch " << maxBatchError
+            << " deg) exceeds " << fastAtan2MaxError << " deg" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    bool passed = checkAngleLookup();
+    passed = checkInterpolateSearch() && passed;
+    passed = checkFastAtan2() && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,341 @@
+﻿#include "dispersion.h"
+#include "ballistics.h"
+#include "ballistics_simd.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Параметры строки поля: гауссиана в системе координат линии стрельбы
+struct RowParams {
+    float dirX, dirY;        // Единичный вектор миномет -> цель
+    float rangeFactor;       // 0.5 / СКО^2 вдоль линии
+    float deflectionFactor;  // 0.5 / СКО^2 поперек линии
+    float norm;              // Площадь клетки / (2 pi СКО СКО)
+};
+
+// Значение гауссианы в клетке со смещением dx, dy (м) от цели
+static float gaussianCell(float dx, float dy, const RowParams& params) {
+    float along = dx * params.dirX + dy * params.dirY;
+    float across = dy * params.dirX - dx * params.dirY;
+    return params.norm * std::exp(-(along * along * params.rangeFactor + across * across * params.deflectionFactor));
+}
+
+// Коэффициенты ряда Тейлора e^r на [-ln2/2, ln2/2]; ошибка меньше 2e-7
+constexpr float expCoefficients[] = { 1.0f, 1.0f, 1.0f / 2, 1.0f / 6, 1.0f / 24, 1.0f / 120, 1.0f / 720 };
+constexpr float log2e = 1.44269504f;
+constexpr float ln2High = 0.693359375f;
+constexpr float ln2Low = -2.12194440e-4f;
+
+#if defined(BALLISTICS_AVX2)
+
+// e^x для 8 значений x <= 0: x = n ln2 + r, e^x = 2^n e^r
+static __m256 expVector(__m256 x) {
+    x = _mm256_max_ps(x, _mm256_set1_ps(-87.0f));
+    __m256i exponent = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(log2e)));
+    __m256 n = _mm256_cvtepi32_ps(exponent);
+    __m256 r = _mm256_sub_ps(_mm256_sub_ps(x, _mm256_mul_ps(n, _mm256_set1_ps(ln2High))), _mm256_mul_ps(n, _mm256_set1_ps(ln2Low)));
+    __m256 polynomial = _mm256_set1_ps(expCoefficients[6]);
+    for (int i = 5; i >= 0; --i) {
+        polynomial = _mm256_add_ps(_mm256_mul_ps(polynomial, r), _mm256_set1_ps(expCoefficients[i]));
+    }
+    __m256i scale = _mm256_slli_epi32(_mm256_add_epi32(exponent, _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(polynomial, _mm256_castsi256_ps(scale));
+}
+
+// 8 клеток строки за итерацию; сумма и максимум накапливаются в регистрах
+static std::size_t accumulateRowVector(float* out, std::size_t count, float dx0, float cellSize, float dy,
+    const RowParams& params, float& sum, float& peak) {
+    const __m256 lanes = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256 step = _mm256_set1_ps(cellSize);
+    const __m256 dirX = _mm256_set1_ps(params.dirX);
+    const __m256 dirY = _mm256_set1_ps(params.dirY);
+    const __m256 vdy = _mm256_set1_ps(dy);
+    __m256 sumVector = _mm256_setzero_ps();
+    __m256 peakVector = _mm256_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 dx = _mm256_add_ps(_mm256_set1_ps(dx0 + i * cellSize), _mm256_mul_ps(lanes, step));
+        __m256 along = _mm256_add_ps(_mm256_mul_ps(dx, dirX), _mm256_mul_ps(vdy, dirY));
+        __m256 across = _mm256_sub_ps(_mm256_mul_ps(vdy, dirX), _mm256_mul_ps(dx, dirY));
+        __m256 exponent = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(along, along), _mm256_set1_ps(params.rangeFactor)),
+            _mm256_mul_ps(_mm256_mul_ps(across, across), _mm256_set1_ps(params.deflectionFactor)));
+        __m256 value = _mm256_mul_ps(_mm256_set1_ps(params.norm), expVector(_mm256_sub_ps(_mm256_setzero_ps(), exponent)));
+        _mm256_storeu_ps(out + i, value);
+        sumVector = _mm256_add_ps(sumVector, value);
+        peakVector = _mm256_max_ps(peakVector, value);
+    }
+    alignas(32) float sums[8];
+    alignas(32) float peaks[8];
+    _mm256_store_ps(sums, sumVector);
+    _mm256_store_ps(peaks, peakVector);
+    for (int lane = 0; lane < 8; ++lane) {
+        sum += sums[lane];
+        peak = std::max(peak, peaks[lane]);
+    }
+    return i;
+}
+
+#elif defined(BALLISTICS_SSE2)
+
+// e^x для 4 значений x <= 0: x = n ln2 + r, e^x = 2^n e^r
+static __m128 expVector(__m128 x) {
+    x = _mm_max_ps(x, _mm_set1_ps(-87.0f));
+    __m128i exponent = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(log2e)));
+    __m128 n = _mm_cvtepi32_ps(exponent);
+    __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(ln2High))), _mm_mul_ps(n, _mm_set1_ps(ln2Low)));
+    __m128 polynomial = _mm_set1_ps(expCoefficients[6]);
+    for (int i = 5; i >= 0; --i) {
+        polynomial = _mm_add_ps(_mm_mul_ps(polynomial, r), _mm_set1_ps(expCoefficients[i]));
+    }
+    __m128i scale = _mm_slli_epi32(_mm_add_epi32(exponent, _mm_set1_epi32(127)), 23);
+    return _mm_mul_ps(polynomial, _mm_castsi128_ps(scale));
+}
+
+// 4 клетки строки за итерацию; сумма и максимум накапливаются в регистрах
+static std::size_t accumulateRowVector(float* out, std::size_t count, float dx0, float cellSize, float dy,
+    const RowParams& params, float& sum, float& peak) {
+    const __m128 lanes = _mm_setr_ps(0, 1, 2, 3);
+    const __m128 step = _mm_set1_ps(cellSize);
+    const __m128 dirX = _mm_set1_ps(params.dirX);
+    const __m128 dirY = _mm_set1_ps(params.dirY);
+    const __m128 vdy = _mm_set1_ps(dy);
+    __m128 sumVector = _mm_setzero_ps();
+    __m128 peakVector = _mm_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_add_ps(_mm_set1_ps(dx0 + i * cellSize), _mm_mul_ps(lanes, step));
+        __m128 along = _mm_add_ps(_mm_mul_ps(dx, dirX), _mm_mul_ps(vdy, dirY));
+        __m128 across = _mm_sub_ps(_mm_mul_ps(vdy, dirX), _mm_mul_ps(dx, dirY));
+        __m128 exponent = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(along, along), _mm_set1_ps(params.rangeFactor)),
+            _mm_mul_ps(_mm_mul_ps(across, across), _mm_set1_ps(params.deflectionFactor)));
+        __m128 value = _mm_mul_ps(_mm_set1_ps(params.norm), expVector(_mm_sub_ps(_mm_setzero_ps(), exponent)));
+        _mm_storeu_ps(out + i, value);
+        sumVector = _mm_add_ps(sumVector, value);
+        peakVector = _mm_max_ps(peakVector, value);
+    }
+    alignas(16) float sums[4];
+    alignas(16) float peaks[4];
+    _mm_store_ps(sums, sumVector);
+    _mm_store_ps(peaks, peakVector);
+    for (int lane = 0; lane < 4; ++lane) {
+        sum += sums[lane];
+        peak = std::max(peak, peaks[lane]);
+    }
+    return i;
+}
+
+#else
+
+// Без SIMD строка считается скалярно
+static std::size_t accumulateRowVector(float*, std::size_t, float, float, float, const RowParams&, float&, float&) {
+    return 0;
+}
+
+#endif
+
+// Строка поля: векторная часть и скалярный хвост
+static void accumulateRow(float* out, std::size_t count, float dx0, float cellSize, float dy, const RowParams& params, float& sum, float& peak) {
+    for (std::size_t i = accumulateRowVector(out, count, dx0, cellSize, dy, params, sum, peak); i < count; ++i) {
+        float value = gaussianCell(dx0 + i * cellSize, dy, params);
+        out[i] = value;
+        sum += value;
+        peak = std::max(peak, value);
+    }
+}
+
+// Объединение прямоугольников; пустые не учитываются
+static CellRect unite(const CellRect& a, const CellRect& b) {
+    if (a.isEmpty()) {
+        return b;
+    }
+    if (b.isEmpty()) {
+        return a;
+    }
+    return CellRect{ std::min(a.x0, b.x0), std::min(a.y0, b.y0), std::max(a.x1, b.x1), std::max(a.y1, b.y1) };
+}
+
+DispersionField::DispersionField(std::size_t width, std::size_t height)
+    : fieldWidth(width), fieldHeight(height), cells(width * height, 0.0f) {
+}
+
+// Обнуление поля
+void DispersionField::clear() {
+    for (std::size_t y = filledRect.y0; y < filledRect.y1; ++y) {
+        std::fill(cells.begin() + y * fieldWidth + filledRect.x0, cells.begin() + y * fieldWidth + filledRect.x1, 0.0f);
+    }
+    dirtyRect = filledRect;
+    filledRect = CellRect{};
+    peakValue = 0.0f;
+    totalValue = 0.0f;
+}
+
+// Пересчет поля для нового решения
+void DispersionField::update(const DispersionRequest& request) {
+    clear();
+    CellRect clearedRect = dirtyRect;
+    if (!(request.mapWidth > 0.0f) || !(request.mapHeight > 0.0f)) {
+        return;
+    }
+
+    // Клетки прямоугольные, если карта не квадратная
+    float cellWidth = request.mapWidth / fieldWidth;
+    float cellHeight = request.mapHeight / fieldHeight;
+    float targetX = request.targetU * request.mapWidth;
+    float targetY = request.targetV * request.mapHeight;
+    float lineX = targetX - request.mortarU * request.mapWidth;
+    float lineY = targetY - request.mortarV * request.mapHeight;
+    float lineLength = std::sqrt(lineX * lineX + lineY * lineY);
+
+    // СКО не меньше половины клетки, иначе гауссиана вырождается
+    float cellSize = std::max(cellWidth, cellHeight);
+    float rangeSigma = std::max(request.model.rangeSigma, cellSize * 0.5f);
+    float deflectionSigma = std::max(request.model.deflectionSigma, cellSize * 0.5f);
+    RowParams params;
+    params.dirX = lineLength > 0.0f ? lineX / lineLength : 0.0f;
+    params.dirY = lineLength > 0.0f ? lineY / lineLength : 1.0f;
+    params.rangeFactor = 0.5f / (rangeSigma * rangeSigma);
+    params.deflectionFactor = 0.5f / (deflectionSigma * deflectionSigma);
+    params.norm = cellWidth * cellHeight / (2.0f * pi * rangeSigma * deflectionSigma);
+
+    // Клетки в пределах 4 СКО от цели
+    float radius = 4.0f * std::max(rangeSigma, deflectionSigma);
+    auto toCell = [](float meters, float size, std::size_t limit) {
+        return static_cast<std::size_t>(std::min(std::max(meters / size, 0.0f), static_cast<float>(limit)));
+    };
+    CellRect rect{ toCell(targetX - radius, cellWidth, fieldWidth), toCell(targetY - radius, cellHeight, fieldHeight),
+        toCell(targetX + radius + cellWidth, cellWidth, fieldWidth), toCell(targetY + radius + cellHeight, cellHeight, fieldHeight) };
+
+    float peak = 0.0f;
+    float total = 0.0f;
+    for (std::size_t y = rect.y0; y < rect.y1; ++y) {
+        float dy = (y + 0.5f) * cellHeight - targetY;
+        float dx0 = (rect.x0 + 0.5f) * cellWidth - targetX;
+        accumulateRow(cells.data() + y * fieldWidth + rect.x0, rect.x1 - rect.x0, dx0, cellWidth, dy, params, total, peak);
+    }
+
+    filledRect = rect;
+    dirtyRect = unite(clearedRect, rect);
+    peakValue = peak;
+    totalValue = total;
+}
+
+// Окраска клеток в RGBA
+void colorizeDispersion(const DispersionField& field, const CellRect& rect, std::uint8_t* rgba) {
+    float scale = field.peak() > 0.0f ? 1.0f / field.peak() : 0.0f;
+    for (std::size_t y = rect.y0; y < rect.y1; ++y) {
+        const float* values = field.values().data() + y * field.width();
+        std::uint8_t* pixel = rgba + (y * field.width() + rect.x0) * 4;
+        for (std::size_t x = rect.x0; x < rect.x1; ++x, pixel += 4) {
+            float t = std::min(values[x] * scale, 1.0f);
+            pixel[0] = 255;
+            pixel[1] = static_cast<std::uint8_t>(255.0f * (1.0f - t));
+            pixel[2] = 0;
+            pixel[3] = t < 0.01f ? 0 : static_cast<std::uint8_t>(40.0f + 170.0f * t);
+        }
+    }
+}
+
+DispersionWorker::DispersionWorker(std::size_t width, std::size_t height)
+    : field(width, height), workImage(width * height * 4, 0), readyImage(width * height * 4, 0) {
+    thread = std::thread(&DispersionWorker::run, this);
+}
+
+DispersionWorker::~DispersionWorker() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    thread.join();
+}
+
+// Запрос расчета; необработанный запрос заменяется
+void DispersionWorker::request(const DispersionRequest& request) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = request;
+        hasPending = true;
+        pendingClear = false;
+    }
+    wake.notify_one();
+}
+
+// Запрос очистки поля
+void DispersionWorker::clear() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        hasPending = false;
+        pendingClear = true;
+    }
+    wake.notify_one();
+}
+
+// Копирование rows строк по rowBytes байт между буферами с шагом строк sourceStride и targetStride
+static void copyRect(const std::uint8_t* source, std::size_t sourceStride, std::uint8_t* target, std::size_t targetStride,
+    std::size_t rows, std::size_t rowBytes) {
+    for (std::size_t y = 0; y < rows; ++y) {
+        std::copy(source + y * sourceStride, source + y * sourceStride + rowBytes, target + y * targetStride);
+    }
+}
+
+// Измененные клетки готового изображения без ожидания
+bool DispersionWorker::takeImage(std::vector<std::uint8_t>& rgba, CellRect& dirty) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!imageReady) {
+        return false;
+    }
+    dirty = readyDirty;
+    std::size_t rowBytes = (dirty.x1 - dirty.x0) * 4;
+    rgba.resize(rowBytes * (dirty.y1 - dirty.y0));
+    if (!dirty.isEmpty()) {
+        std::size_t stride = field.width() * 4;
+        copyRect(readyImage.data() + dirty.y0 * stride + dirty.x0 * 4, stride, rgba.data(), rowBytes, dirty.y1 - dirty.y0, rowBytes);
+    }
+    readyDirty = CellRect{};
+    imageReady = false;
+    return true;
+}
+
+// Есть ли незавершенный запрос или не забранное изображение
+bool DispersionWorker::isBusy() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hasPending || pendingClear || computing || imageReady;
+}
+
+// Цикл потока: ждет запрос, считает поле вне блокировки и публикует изображение
+void DispersionWorker::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return stopping || hasPending || pendingClear; });
+        if (stopping) {
+            return;
+        }
+        DispersionRequest current = pending;
+        bool clearOnly = pendingClear;
+        hasPending = false;
+        pendingClear = false;
+        computing = true;
+        lock.unlock();
+
+        if (clearOnly) {
+            field.clear();
+        }
+        else {
+            field.update(current);
+        }
+        const CellRect& dirty = field.dirty();
+        colorizeDispersion(field, dirty, workImage.data());
+
+        // В опубликованное изображение копируются только измененные клетки; непрочитанные
+        // изменения прошлых расчетов остаются в readyDirty
+        lock.lock();
+        if (!dirty.isEmpty()) {
+            std::size_t stride = field.width() * 4;
+            std::size_t offset = dirty.y0 * stride + dirty.x0 * 4;
+            copyRect(workImage.data() + offset, stride, readyImage.data() + offset, stride, dirty.y1 - dirty.y0, (dirty.x1 - dirty.x0) * 4);
+        }
+        readyDirty = unite(readyDirty, dirty);
+        imageReady = true;
+        computing = false;
+    }
+}
@@ -0,0 +1,118 @@
+﻿#pragma once
+
+// Поле вероятности попадания по карте для текущего решения.
+// Считается в фоновом потоке, чтобы не задерживать кадр.
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Модель рассеивания: нормальное распределение вдоль линии стрельбы и поперек нее (СКО, м)
+struct DispersionModel {
+    float rangeSigma = 0.0f;
+    float deflectionSigma = 0.0f;
+};
+
+// Решение для поля: миномет и цель в нормированных координатах карты [0, 1]
+struct DispersionRequest {
+    float mortarU = 0.0f, mortarV = 0.0f;
+    float targetU = 0.0f, targetV = 0.0f;
+    float mapWidth = 0.0f, mapHeight = 0.0f; // Размер карты (м)
+    DispersionModel model;
+};
+
+inline bool operator==(const DispersionRequest& a, const DispersionRequest& b) {
+    return a.mortarU == b.mortarU && a.mortarV == b.mortarV && a.targetU == b.targetU && a.targetV == b.targetV &&
+        a.mapWidth == b.mapWidth && a.mapHeight == b.mapHeight && a.model.rangeSigma == b.model.rangeSigma && a.model.deflectionSigma == b.model.deflectionSigma;
+}
+
+// Прямоугольник клеток [x0, x1) x [y0, y1)
+struct CellRect {
+    std::size_t x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    bool isEmpty() const { return x0 >= x1 || y0 >= y1; }
+};
+
+// Поле на сетке width x height, покрывающей всю карту; значение клетки - вероятность попадания в нее
+class DispersionField {
+public:
+    DispersionField(std::size_t width, std::size_t height);
+
+    // Пересчет для нового решения. Перезаписываются только клетки в пределах
+    // 4 СКО от прежней и новой цели, остальное поле не трогается.
+    void update(const DispersionRequest& request);
+
+    // Обнуление поля
+    void clear();
+
+    const std::vector<float>& values() const { return cells; }
+    std::size_t width() const { return fieldWidth; }
+    std::size_t height() const { return fieldHeight; }
+
+    // Максимум и сумма поля после последнего update
+    float peak() const { return peakValue; }
+    float total() const { return totalValue; }
+
+    // Клетки, измененные последним update или clear
+    const CellRect& dirty() const { return dirtyRect; }
+
+private:
+    std::size_t fieldWidth;
+    std::size_t fieldHeight;
+    std::vector<float> cells;
+    CellRect filledRect;
+    CellRect dirtyRect;
+    float peakValue = 0.0f;
+    float totalValue = 0.0f;
+};
+
+// Окраска клеток rect в RGBA (width * height * 4 байт): от прозрачного желтого до красного у максимума
+void colorizeDispersion(const DispersionField& field, const CellRect& rect, std::uint8_t* rgba);
+
+// Фоновый расчет поля. Новый запрос заменяет еще не начатый, поэтому при перетаскивании
+// цели поток всегда считает последнее положение, а главный поток только забирает готовое изображение.
+// Изображение публикуется вместе с измененными клетками, и копируются только они.
+class DispersionWorker {
+public:
+    DispersionWorker(std::size_t width, std::size_t height);
+    ~DispersionWorker();
+
+    DispersionWorker(const DispersionWorker&) = delete;
+    DispersionWorker& operator=(const DispersionWorker&) = delete;
+
+    // Запрос расчета для нового решения
+    void request(const DispersionRequest& request);
+
+    // Запрос очистки поля
+    void clear();
+
+    // Если готово новое изображение, записывает в rgba подряд пиксели клеток, измененных с прошлого вызова
+    // (dirty.x1 - dirty.x0) x (dirty.y1 - dirty.y0), и возвращает true. Не блокирует.
+    bool takeImage(std::vector<std::uint8_t>& rgba, CellRect& dirty);
+
+    // Есть ли незавершенный запрос или не забранное изображение
+    bool isBusy();
+
+    std::size_t width() const { return field.width(); }
+    std::size_t height() const { return field.height(); }
+
+private:
+    void run();
+
+    DispersionField field;
+    std::vector<std::uint8_t> workImage;
+    std::vector<std::uint8_t> readyImage;
+    CellRect readyDirty; // Клетки readyImage, измененные с прошлого takeImage
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    DispersionRequest pending;
+    bool hasPending = false;
+    bool pendingClear = false;
+    bool imageReady = false;
+    bool computing = false;
+    bool stopping = false;
+    std::thread thread;
+};
@@ -0,0 +1,54 @@
+﻿#include "frame_pacer.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+// Частота, если система не сообщает частоту экрана
+const float fallbackRefreshRate = 60.0f;
+
+// Кадров в одном замере темпа
+const unsigned pacingSampleFrames = 30;
+
+// Частота обновления основного экрана; 0 и 1 в dmDisplayFrequency означают частоту по умолчанию
+static float queryRefreshRate() {
+#ifdef _WIN32
+    DEVMODEW mode = {};
+    mode.dmSize = sizeof(mode);
+    if (EnumDisplaySettingsW(nullptr, ENUM_CURRENT_SETTINGS, &mode) && mode.dmDisplayFrequency > 1) {
+        return static_cast<float>(mode.dmDisplayFrequency);
+    }
+#endif
+    return fallbackRefreshRate;
+}
+
+FramePacer::FramePacer() : rate(queryRefreshRate()) {
+}
+
+// Замеряется время от конца предыдущего кадра (после сна) до возврата из display в кадрах,
+// идущих подряд без сна. Если vsync задает темп, оно близко к периоду обновления экрана,
+// иначе это только время обработки и отрисовки. Результат не пересматривается: после сна
+// display ждет лишь остаток периода, и такой замер ничего не говорит о vsync.
+void FramePacer::endFrame(float frameRate) {
+    sf::Time frameTime = frameClock.getElapsedTime();
+    if (measureNext && pacing) {
+        measuredTime += frameTime;
+        if (++measuredFrames == pacingSampleFrames) {
+            pacing = measuredTime.asSeconds() / measuredFrames >= 0.5f / rate;
+            measuredTime = sf::Time::Zero;
+            measuredFrames = 0;
+        }
+    }
+
+    measureNext = true;
+    if (frameRate > 0.0f) {
+        sf::Time frameLimit = sf::seconds(1.0f / frameRate);
+        if (frameTime < frameLimit) {
+            sf::sleep(frameLimit - frameTime);
+            measureNext = false;
+        }
+    }
+    frameClock.restart();
+}
@@ -0,0 +1,31 @@
+﻿#pragma once
+
+// Досыпание до срока кадра, когда vsync не задает темп: драйвер может отключить vsync
+// или окно может быть свернуто, и тогда display возвращается сразу, а цикл занимает ядро целиком.
+
+#include <SFML/System.hpp>
+
+class FramePacer {
+public:
+    FramePacer();
+
+    // Частота обновления экрана (Гц); если система ее не сообщает - fallbackRefreshRate
+    float refreshRate() const { return rate; }
+
+    // false, только когда замер показал, что display не ждет обновления экрана
+    bool vsyncPacing() const { return pacing; }
+
+    // Следующий кадр начнется после ожидания события или простоя, его время не замеряется
+    void skipMeasurement() { measureNext = false; }
+
+    // Вызывается после window.display(): замер темпа и сон до срока кадра; frameRate 0 - без сна
+    void endFrame(float frameRate);
+
+private:
+    float rate;
+    bool pacing = true;
+    bool measureNext = false;
+    sf::Clock frameClock;
+    sf::Time measuredTime;
+    unsigned measuredFrames = 0;
+};
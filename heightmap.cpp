@@ -0,0 +1,172 @@
+﻿#include "heightmap.h"
+#include "ballistics.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+static const char heightmapMagic[4] = { 'H', 'M', 'A', 'P' };
+static const std::uint16_t heightmapVersion = 1;
+static const std::size_t heightmapHeaderSize = 4 + 2 * 4 + 4 * 2 + 4;
+
+// Тысячные в радиане (6400 на круг)
+static const float milsPerRadian = 3200.0f / pi;
+
+Heightmap::Heightmap(std::string path) : path(std::move(path)) {
+}
+
+// Распаковка в память
+bool Heightmap::decode(std::string& error) {
+    if (decoded) {
+        return true;
+    }
+    if (failed || path.empty()) {
+        error = "Heightmap is not available";
+        return false;
+    }
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        failed = true;
+        error = "Failed to open " + path;
+        return false;
+    }
+    std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!decodeHeightmap(bytes.data(), bytes.size(), width, height, baseHeight, heightStep, samples, error)) {
+        failed = true;
+        error = path + ": " + error;
+        return false;
+    }
+    decoded = true;
+    return true;
+}
+
+// Высота в точке карты, билинейная фильтрация
+bool Heightmap::sample(float u, float v, float& result) {
+    std::string error;
+    if (!decoded && !decode(error)) {
+        return false;
+    }
+    float x = std::fmin(std::fmax(u, 0.0f), 1.0f) * (width - 1);
+    float y = std::fmin(std::fmax(v, 0.0f), 1.0f) * (height - 1);
+    std::size_t x0 = static_cast<std::size_t>(x);
+    std::size_t y0 = static_cast<std::size_t>(y);
+    std::size_t x1 = x0 + 1 < width ? x0 + 1 : x0;
+    std::size_t y1 = y0 + 1 < height ? y0 + 1 : y0;
+    float tx = x - x0;
+    float ty = y - y0;
+    float top = samples[y0 * width + x0] + tx * (samples[y0 * width + x1] - samples[y0 * width + x0]);
+    float bottom = samples[y1 * width + x0] + tx * (samples[y1 * width + x1] - samples[y1 * width + x0]);
+    result = baseHeight + heightStep * (top + ty * (bottom - top));
+    return true;
+}
+
+template <typename T>
+static void appendValue(std::vector<unsigned char>& bytes, T value) {
+    unsigned char raw[sizeof(T)];
+    std::memcpy(raw, &value, sizeof(T));
+    bytes.insert(bytes.end(), raw, raw + sizeof(T));
+}
+
+template <typename T>
+static T readValue(const unsigned char* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+// Сжатие отсчетов в формат .hmap
+std::vector<unsigned char> encodeHeightmap(std::uint16_t width, std::uint16_t height, const std::vector<std::uint16_t>& samples,
+    float baseHeight, float heightStep) {
+    std::vector<unsigned char> payload;
+    payload.reserve(samples.size());
+    std::int32_t previous = 0;
+    for (std::uint16_t sample : samples) {
+        std::int32_t delta = static_cast<std::int32_t>(sample) - previous;
+        previous = sample;
+        std::uint32_t zigzag = (static_cast<std::uint32_t>(delta) << 1) ^ static_cast<std::uint32_t>(delta >> 31);
+        while (zigzag >= 0x80) {
+            payload.push_back(static_cast<unsigned char>(zigzag | 0x80));
+            zigzag >>= 7;
+        }
+        payload.push_back(static_cast<unsigned char>(zigzag));
+    }
+
+    std::vector<unsigned char> bytes(heightmapMagic, heightmapMagic + 4);
+    appendValue(bytes, heightmapVersion);
+    appendValue(bytes, width);
+    appendValue(bytes, height);
+    appendValue(bytes, std::uint16_t(0));
+    appendValue(bytes, baseHeight);
+    appendValue(bytes, heightStep);
+    appendValue(bytes, static_cast<std::uint32_t>(payload.size()));
+    bytes.insert(bytes.end(), payload.begin(), payload.end());
+    return bytes;
+}
+
+// Распаковка .hmap из памяти
+bool decodeHeightmap(const unsigned char* data, std::size_t size, std::uint16_t& width, std::uint16_t& height,
+    float& baseHeight, float& heightStep, std::vector<std::uint16_t>& samples, std::string& error) {
+    if (size < heightmapHeaderSize || std::memcmp(data, heightmapMagic, 4) != 0) {
+        error = "not a heightmap file";
+        return false;
+    }
+    if (readValue<std::uint16_t>(data + 4) != heightmapVersion) {
+        error = "unsupported heightmap version";
+        return false;
+    }
+    width = readValue<std::uint16_t>(data + 6);
+    height = readValue<std::uint16_t>(data + 8);
+    baseHeight = readValue<float>(data + 12);
+    heightStep = readValue<float>(data + 16);
+    std::uint32_t payloadSize = readValue<std::uint32_t>(data + 20);
+    if (width < 2 || height < 2 || payloadSize > size - heightmapHeaderSize) {
+        error = "corrupted heightmap header";
+        return false;
+    }
+
+    const unsigned char* input = data + heightmapHeaderSize;
+    const unsigned char* end = input + payloadSize;
+    samples.resize(static_cast<std::size_t>(width) * height);
+    std::int32_t previous = 0;
+    for (std::uint16_t& sample : samples) {
+        std::uint32_t zigzag = 0;
+        int shift = 0;
+        while (true) {
+            if (input == end || shift > 28) {
+                error = "truncated heightmap data";
+                return false;
+            }
+            unsigned char byte = *input++;
+            zigzag |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            shift += 7;
+            if (!(byte & 0x80)) {
+                break;
+            }
+        }
+        std::int32_t delta = static_cast<std::int32_t>(zigzag >> 1) ^ -static_cast<std::int32_t>(zigzag & 1);
+        previous += delta;
+        sample = static_cast<std::uint16_t>(previous);
+    }
+    return true;
+}
+
+// Угол навесной траектории в пустоте (радианы); NaN, если цель недостижима
+static float vacuumHighAngle(float distance, float heightDifference, float ballisticRange) {
+    float discriminant = ballisticRange * ballisticRange - distance * distance - 2.0f * heightDifference * ballisticRange;
+    if (discriminant < 0.0f || distance <= 0.0f) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    return std::atan((ballisticRange + std::sqrt(discriminant)) / distance);
+}
+
+// Угол с поправкой на превышение цели над минометом
+float heightCorrectedAngle(float tableAngle, float distance, float heightDifference, float ballisticRange) {
+    float flat = vacuumHighAngle(distance, 0.0f, ballisticRange);
+    float corrected = vacuumHighAngle(distance, heightDifference, ballisticRange);
+    if (std::isnan(flat)) {
+        return tableAngle;
+    }
+    return tableAngle + (corrected - flat) * milsPerRadian;
+}
@@ -0,0 +1,61 @@
+﻿#pragma once
+
+// Карты высот. Хранятся рядом с картами в сжатом 16-битном формате .hmap (Heightmaps/<карта>.hmap,
+// пишет MapPackBuilder с ключом --heightmaps) и распаковываются только при первом обращении,
+// поэтому смена карты ничего не читает с диска.
+//
+// Формат .hmap (little-endian):
+//   char[4]  "HMAP"
+//   uint16   версия (1)
+//   uint16   ширина, uint16 высота, uint16 резерв
+//   float    высота нулевого отсчета (м), float шаг высоты (м на единицу)
+//   uint32   размер сжатых данных
+//   байты    отсчеты построчно: разность с предыдущим отсчетом, zigzag, varint (LEB128)
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Heightmap {
+public:
+    Heightmap() = default;
+
+    // Запоминает путь к файлу; чтение и распаковка откладываются до первого sample
+    explicit Heightmap(std::string path);
+
+    // Есть ли карта высот: файл задан и не оказался поврежденным
+    bool isAvailable() const { return !path.empty() && !failed; }
+
+    // Высота (м) в точке карты с нормированными координатами u, v в [0, 1], билинейная фильтрация.
+    // Возвращает false, если карты высот нет или файл поврежден.
+    bool sample(float u, float v, float& height);
+
+    // Распаковка в память; вызывается из sample при первом обращении
+    bool decode(std::string& error);
+
+    bool isDecoded() const { return decoded; }
+
+private:
+    std::string path;
+    bool decoded = false;
+    bool failed = false;
+    std::uint16_t width = 0;
+    std::uint16_t height = 0;
+    float baseHeight = 0.0f;
+    float heightStep = 1.0f;
+    std::vector<std::uint16_t> samples;
+};
+
+// Сжатие отсчетов в формат .hmap; карты высот пишет MapPackBuilder с ключом --heightmaps
+std::vector<unsigned char> encodeHeightmap(std::uint16_t width, std::uint16_t height, const std::vector<std::uint16_t>& samples,
+    float baseHeight, float heightStep);
+
+// Распаковка .hmap из памяти
+bool decodeHeightmap(const unsigned char* data, std::size_t size, std::uint16_t& width, std::uint16_t& height,
+    float& baseHeight, float& heightStep, std::vector<std::uint16_t>& samples, std::string& error);
+
+// Угол (тысячные) с поправкой на превышение цели над минометом (м).
+// Поправка - разность углов навесной траектории в пустоте с превышением и без него;
+// ballisticRange - дальность при 45 градусах (v^2 / g), для миномета PR это 1500м.
+// Если цель недостижима, возвращает NaN.
+float heightCorrectedAngle(float tableAngle, float distance, float heightDifference, float ballisticRange);
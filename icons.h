@@ -1,366 +0,0 @@
-unsigned char ico_h[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7A, 0x7A,
-0xF4, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE,
-0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B,
-0xFC, 0x61, 0x05, 0x00, 0x00, 0x01, 0xB1, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xCD, 0x57, 0xC1,
-0x51, 0xC3, 0x30, 0x10, 0xDC, 0x80, 0x3F, 0xFC, 0xD2, 0x01, 0xEE, 0x20, 0xA4, 0x82, 0x98, 0x0E,
-0xA0, 0x84, 0x54, 0x40, 0x3A, 0xE0, 0xE8, 0x00, 0x2A, 0xA0, 0x04, 0x42, 0x05, 0x24, 0x15, 0x10,
-0x2A, 0x20, 0x3C, 0xF9, 0xE5, 0xC9, 0x13, 0xED, 0xE8, 0x34, 0x08, 0x8F, 0x2D, 0xFB, 0x44, 0x48,
-0xBC, 0x33, 0x37, 0x92, 0xCF, 0x76, 0xEE, 0xB4, 0x7B, 0x27, 0x39, 0x23, 0x00, 0x17, 0xCE, 0xAE,
-0x90, 0x87, 0x89, 0x8E, 0x6F, 0xC8, 0xC3, 0xB2, 0xD0, 0xE0, 0x33, 0x67, 0x6B, 0xD8, 0x31, 0x46,
-0x3E, 0x18, 0x13, 0x85, 0x5E, 0x30, 0xB8, 0xC0, 0x0E, 0xA9, 0x8D, 0xE6, 0x77, 0x4F, 0x70, 0x64,
-0x0C, 0x3E, 0x01, 0x41, 0x1E, 0xBD, 0x7B, 0x4B, 0xE0, 0xDF, 0x71, 0xF4, 0x04, 0x8A, 0x06, 0x9F,
-0x44, 0xF3, 0x59, 0x83, 0x4F, 0x90, 0x86, 0x58, 0xEE, 0x0D, 0x9E, 0x01, 0x69, 0xF0, 0x75, 0xC1,
-0xF2, 0xEC, 0x9F, 0x18, 0xA8, 0xE0, 0xB7, 0xE2, 0x99, 0xCE, 0xB3, 0x50, 0xC0, 0x0E, 0x6E, 0xBF,
-0x4F, 0x3A, 0xE7, 0x19, 0xF0, 0xE1, 0xEC, 0xD1, 0xD9, 0xC6, 0xD9, 0xDC, 0xD9, 0x0E, 0x06, 0x74,
-0x25, 0x20, 0x0D, 0x3E, 0x06, 0xAB, 0x6F, 0xDD, 0x0B, 0xBD, 0x66, 0x62, 0x97, 0x30, 0xC0, 0x2A,
-0x41, 0x05, 0x7F, 0x7A, 0x4A, 0xE4, 0x2B, 0x9D, 0xDD, 0x46, 0xBE, 0x0A, 0x06, 0x90, 0x01, 0xEA,
-0x38, 0x46, 0xBF, 0xE2, 0xA1, 0xDE, 0xCF, 0xB5, 0xE0, 0x5C, 0xF5, 0xB5, 0x5E, 0x53, 0x92, 0x9B,
-0x9E, 0x49, 0xF0, 0xB7, 0x76, 0x56, 0x06, 0x62, 0x7D, 0x79, 0x8C, 0x53, 0x8E, 0x87, 0x9A, 0xDF,
-0x7C, 0x44, 0x0B, 0xFA, 0xB7, 0x4E, 0xE5, 0xEC, 0x45, 0xE7, 0xAF, 0xF0, 0x85, 0x47, 0x2C, 0x74,
-0x7C, 0x47, 0x7F, 0x09, 0x84, 0x66, 0x65, 0x60, 0xA5, 0x23, 0x35, 0x9F, 0xC2, 0xD7, 0x03, 0x71,
-0xAF, 0xBE, 0x4D, 0xF4, 0x4C, 0x2F, 0xE4, 0xB4, 0x21, 0xF5, 0x26, 0xF5, 0x5C, 0x6D, 0xA8, 0x87,
-0x49, 0x74, 0xCF, 0x84, 0x14, 0x03, 0x4D, 0x5A, 0x96, 0xF0, 0x7A, 0x33, 0xD0, 0x5C, 0x03, 0x9F,
-0x3B, 0xBB, 0x83, 0x6F, 0x3F, 0xD3, 0x1E, 0x40, 0xB4, 0x31, 0x50, 0xC2, 0x6B, 0xCD, 0x40, 0x41,
-0x67, 0xD2, 0xCD, 0x8A, 0x9F, 0x6A, 0xA0, 0x15, 0x7E, 0xF4, 0x5E, 0x45, 0xEF, 0x0A, 0xDA, 0x21,
-0x7D, 0x13, 0xD8, 0x6A, 0xF0, 0xB8, 0xC5, 0xC2, 0xDC, 0xBC, 0xCA, 0x14, 0x52, 0x35, 0xB0, 0x89,
-0x92, 0x00, 0x7E, 0xB3, 0x91, 0x82, 0xC0, 0x80, 0x41, 0x1E, 0xC7, 0x01, 0x41, 0xF3, 0xBA, 0x04,
-0x5D, 0x2C, 0x88, 0xE5, 0x5E, 0x1B, 0x03, 0xE3, 0x5A, 0xC0, 0x58, 0x8E, 0x12, 0x7B, 0x44, 0x1B,
-0x03, 0x2C, 0x34, 0xB6, 0xD5, 0x36, 0xF2, 0x31, 0x89, 0xD0, 0x01, 0x29, 0x08, 0x0C, 0x48, 0xD5,
-0xC0, 0xB6, 0xC1, 0xB7, 0xD7, 0x0E, 0xE8, 0x4A, 0xE0, 0x20, 0x18, 0xC1, 0x53, 0x96, 0xFB, 0xE7,
-0x34, 0x7C, 0x35, 0xE7, 0xBE, 0xBB, 0x3E, 0x85, 0xA7, 0xF5, 0x0C, 0x79, 0x60, 0xB1, 0x7E, 0x39,
-0xFB, 0x84, 0x1D, 0xFC, 0x94, 0x5B, 0x7E, 0x03, 0x7A, 0xCF, 0x57, 0xF0, 0xE5, 0x1B, 0xA7, 0x2A,
-0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-unsigned char settings_h[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x08, 0x06, 0x00, 0x00, 0x00, 0xAA, 0x69, 0x71,
-0xDE, 0x00, 0x00, 0x00, 0x03, 0x73, 0x42, 0x49, 0x54, 0x08, 0x08, 0x08, 0xDB, 0xE1, 0x4F, 0xE0,
-0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00,
-0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00, 0x00,
-0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0E, 0xC4, 0x00, 0x00, 0x0E, 0xC4, 0x01, 0x95, 0x2B,
-0x0E, 0x1B, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61,
-0x72, 0x65, 0x00, 0x77, 0x77, 0x77, 0x2E, 0x69, 0x6E, 0x6B, 0x73, 0x63, 0x61, 0x70, 0x65, 0x2E,
-0x6F, 0x72, 0x67, 0x9B, 0xEE, 0x3C, 0x1A, 0x00, 0x00, 0x05, 0x4F, 0x49, 0x44, 0x41, 0x54, 0x78,
-0x5E, 0xED, 0x9B, 0xBB, 0x2F, 0x34, 0x6F, 0x14, 0xC7, 0x1F, 0x84, 0xB8, 0xDF, 0x12, 0x24, 0x8B,
-0x4A, 0xA1, 0xA0, 0xA0, 0x13, 0x22, 0x91, 0x48, 0x48, 0x54, 0xAB, 0xA1, 0x11, 0x89, 0xB8, 0x26,
-0x2A, 0xAB, 0xF0, 0x6F, 0x68, 0x44, 0x82, 0x02, 0x85, 0x42, 0xA5, 0xD0, 0x6A, 0x90, 0xB8, 0x24,
-0x12, 0x41, 0x41, 0xA1, 0x62, 0x13, 0x41, 0xD6, 0x35, 0x41, 0xC1, 0xFC, 0xE6, 0x3B, 0xCE, 0x78,
-0x77, 0x67, 0xCF, 0x33, 0x97, 0x9D, 0x19, 0x7E, 0xDE, 0x79, 0x3F, 0xC9, 0xD7, 0x3E, 0x3B, 0x73,
-0xCE, 0x79, 0xCE, 0x79, 0x3C, 0x73, 0x9F, 0x15, 0x8A, 0x4F, 0xAC, 0xAF, 0xAF, 0x2B, 0xE5, 0xE5,
-0xE5, 0x8A, 0x10, 0xC2, 0x95, 0x10, 0x03, 0xB1, 0xFC, 0xC2, 0x97, 0x01, 0xD8, 0xDF, 0xDF, 0x67,
-0x8B, 0x71, 0x23, 0xC4, 0xF4, 0x03, 0x5F, 0x06, 0xA0, 0xBB, 0xBB, 0x9B, 0x2D, 0xC2, 0x8D, 0x10,
-0xD3, 0x0F, 0xD2, 0xD5, 0xE0, 0x9E, 0xF3, 0xF2, 0xF2, 0x42, 0x2D, 0xEF, 0xF0, 0x23, 0x26, 0xF0,
-0x65, 0x00, 0xD2, 0xD3, 0xBD, 0x0F, 0xEB, 0x47, 0x4C, 0xE0, 0x4F, 0x54, 0x09, 0xA1, 0x50, 0x48,
-0x54, 0x56, 0x56, 0x6A, 0x9F, 0x9C, 0xF4, 0x75, 0xDF, 0x0A, 0x6D, 0x0A, 0x9E, 0xD2, 0xD5, 0xD5,
-0xC5, 0x6E, 0xC7, 0x76, 0xE1, 0x7C, 0x11, 0xD3, 0x0F, 0x6C, 0xCF, 0x80, 0x9B, 0x9B, 0x1B, 0x6A,
-0xA5, 0xCE, 0xDD, 0xDD, 0x1D, 0xB5, 0xE4, 0xD8, 0xB1, 0xB1, 0xC2, 0x49, 0xAE, 0x96, 0x03, 0x70,
-0x79, 0x79, 0x29, 0xD2, 0xD2, 0xD2, 0x84, 0x7A, 0x3C, 0xD6, 0x3E, 0x47, 0x46, 0x46, 0x68, 0xCD,
-0xFF, 0x0F, 0xE4, 0x16, 0x9F, 0x6B, 0x34, 0x1A, 0xA5, 0x35, 0x26, 0xD0, 0x4C, 0x90, 0x02, 0x13,
-0x4E, 0x0B, 0x0B, 0x0B, 0x64, 0x91, 0x8C, 0x6C, 0x13, 0x88, 0xC5, 0x62, 0x64, 0x21, 0x07, 0x36,
-0x9C, 0xAF, 0xD9, 0x26, 0x80, 0x5C, 0x38, 0x1F, 0xC8, 0x0A, 0xD3, 0x19, 0x10, 0x89, 0x44, 0xA8,
-0x95, 0xCC, 0xD0, 0xD0, 0x90, 0xC8, 0xCF, 0xCF, 0x17, 0x27, 0x27, 0x27, 0xB4, 0xE4, 0x0F, 0x59,
-0x59, 0x59, 0xD4, 0xF2, 0x0E, 0x2E, 0x26, 0xFA, 0x46, 0x0E, 0xC8, 0x45, 0xC6, 0xE4, 0xE4, 0x24,
-0xB5, 0x24, 0xD0, 0x40, 0x24, 0xF1, 0xFE, 0xFE, 0xCE, 0x8E, 0x28, 0xA7, 0x96, 0x96, 0x16, 0xE5,
-0xE3, 0xE3, 0x43, 0xF3, 0xBB, 0xBA, 0xBA, 0x52, 0x8A, 0x8B, 0x8B, 0x59, 0x3B, 0x37, 0x33, 0x00,
-0x31, 0x11, 0x1B, 0xA0, 0x2F, 0xF4, 0xC9, 0xD9, 0x71, 0xD2, 0x73, 0xE3, 0x90, 0x0E, 0x40, 0x73,
-0x73, 0x33, 0x1B, 0xCC, 0x4C, 0x1D, 0x1D, 0x1D, 0xEC, 0x72, 0x5D, 0xB7, 0xB7, 0xB7, 0x14, 0x5D,
-0x0E, 0x6C, 0x38, 0x5F, 0x5D, 0x56, 0x7D, 0x70, 0xC2, 0x60, 0xC9, 0x60, 0x07, 0xE0, 0xE8, 0xE8,
-0x88, 0x0D, 0xE4, 0x56, 0xAF, 0xAF, 0xAF, 0xD4, 0x83, 0x1C, 0xD8, 0x70, 0xBE, 0x6E, 0x85, 0x9A,
-0x38, 0xD8, 0x01, 0xC8, 0xC9, 0xC9, 0x61, 0x83, 0xA8, 0xDB, 0x21, 0xBB, 0xDC, 0x8E, 0x70, 0x55,
-0x67, 0x17, 0x37, 0x57, 0x91, 0xB2, 0x1C, 0x73, 0x73, 0x73, 0x29, 0x7A, 0x22, 0x49, 0x03, 0x30,
-0x37, 0x37, 0xC7, 0x06, 0x80, 0x0E, 0x0F, 0x0F, 0x35, 0x9B, 0x86, 0x86, 0x06, 0x76, 0xBD, 0x4C,
-0xEA, 0x19, 0x9E, 0xE6, 0xE7, 0x04, 0xF8, 0x70, 0xB1, 0x64, 0x42, 0x4E, 0x00, 0x39, 0x72, 0xEB,
-0xA1, 0xF9, 0xF9, 0x79, 0xCD, 0x26, 0x9E, 0xA4, 0x01, 0xE0, 0x1C, 0xA1, 0xC6, 0xC6, 0x46, 0xB2,
-0xF8, 0x64, 0x67, 0x67, 0x47, 0xC9, 0xC8, 0xC8, 0x60, 0x6D, 0x75, 0xD5, 0xD4, 0xD4, 0x28, 0x67,
-0x67, 0x67, 0xE4, 0xE1, 0x1C, 0xF8, 0x22, 0x06, 0x17, 0x5B, 0x17, 0x72, 0xD8, 0xDD, 0xDD, 0x25,
-0x8F, 0x4F, 0x90, 0x2B, 0x67, 0x0B, 0x19, 0x49, 0x58, 0x32, 0x38, 0x38, 0xC8, 0x3A, 0x41, 0xB2,
-0xED, 0x77, 0x7A, 0x7A, 0x9A, 0xB5, 0x5F, 0x5B, 0x5B, 0x23, 0x0B, 0xF7, 0x20, 0x16, 0xD7, 0x07,
-0xFA, 0xE6, 0x30, 0xDB, 0x8F, 0xA8, 0x87, 0x4C, 0xB2, 0xFA, 0xE4, 0x6B, 0x00, 0x9E, 0x9F, 0x9F,
-0x59, 0x07, 0x68, 0x6C, 0x6C, 0x8C, 0xAC, 0xE4, 0x8C, 0x8E, 0x8E, 0x2A, 0xB5, 0xB5, 0xB5, 0x4A,
-0x6F, 0x6F, 0x2F, 0x2D, 0xF1, 0x1E, 0xC4, 0x46, 0x1F, 0xE8, 0xCB, 0x0A, 0xE4, 0xCC, 0xD5, 0x02,
-0xA1, 0x56, 0x9D, 0xAF, 0x01, 0xA8, 0xAF, 0xAF, 0x67, 0x8D, 0xA1, 0xDF, 0x0A, 0x57, 0x0B, 0x84,
-0x5A, 0x75, 0xB4, 0xEA, 0xB6, 0xB7, 0xB7, 0x59, 0x43, 0x68, 0x71, 0x71, 0x51, 0x33, 0xFC, 0x8D,
-0x20, 0x77, 0xAE, 0x26, 0x08, 0x35, 0x83, 0x34, 0xED, 0x8F, 0x7A, 0xE1, 0xC0, 0x51, 0x50, 0x50,
-0x20, 0x1E, 0x1F, 0x1F, 0xE9, 0x9B, 0x77, 0xAC, 0xAE, 0xAE, 0x8A, 0xAD, 0xAD, 0x2D, 0x71, 0x71,
-0x71, 0xA1, 0x7D, 0xAF, 0xAE, 0xAE, 0x16, 0xAD, 0xAD, 0xAD, 0xA2, 0xA7, 0xA7, 0x47, 0xFB, 0xEE,
-0x25, 0x85, 0x85, 0x85, 0xE2, 0xE9, 0xE9, 0x89, 0xBE, 0x25, 0xA2, 0x96, 0x2E, 0x84, 0xD9, 0x61,
-0x4F, 0x3F, 0xF5, 0xF4, 0x82, 0xB7, 0xB7, 0x37, 0xA5, 0xB3, 0xB3, 0x93, 0xED, 0x27, 0x5E, 0xB0,
-0x81, 0xAD, 0x57, 0xA0, 0x06, 0xAE, 0x1F, 0x08, 0x87, 0x45, 0x51, 0x51, 0x51, 0xC1, 0xAE, 0x84,
-0xA6, 0xA6, 0xA6, 0x28, 0x8C, 0x3B, 0x66, 0x67, 0x67, 0xD9, 0xF8, 0x66, 0x82, 0x8F, 0x17, 0xA0,
-0x06, 0x2E, 0x3E, 0xA4, 0xD5, 0x9E, 0x99, 0x99, 0xC9, 0xAE, 0x8C, 0xD7, 0xCA, 0xCA, 0x0A, 0x85,
-0x73, 0xCE, 0xF8, 0xF8, 0x38, 0x1B, 0xD3, 0x8E, 0xE0, 0x9B, 0x2A, 0xC8, 0x99, 0x8B, 0x19, 0x2F,
-0xED, 0xAC, 0x71, 0x60, 0x60, 0x80, 0x5D, 0x69, 0x54, 0x69, 0x69, 0xA9, 0x72, 0x7E, 0x7E, 0x4E,
-0xE1, 0xED, 0x91, 0xCA, 0x7F, 0xDE, 0x28, 0xA7, 0x33, 0x01, 0x39, 0x22, 0x57, 0x2E, 0x96, 0x51,
-0x5A, 0xED, 0x70, 0x6A, 0x6A, 0x6A, 0x62, 0x0D, 0x38, 0xE1, 0x6A, 0xCC, 0x0E, 0xD8, 0x8E, 0x39,
-0xFF, 0x54, 0x64, 0x77, 0x9F, 0xE0, 0xE4, 0x4A, 0x11, 0x35, 0x83, 0xAF, 0x83, 0xFC, 0xC1, 0xC1,
-0x81, 0xA3, 0x8B, 0x1D, 0x2B, 0xCC, 0x76, 0x78, 0xD9, 0xD9, 0xD9, 0xCA, 0xF2, 0xF2, 0xB2, 0x12,
-0x8D, 0x46, 0x35, 0xA1, 0x8D, 0x65, 0x9C, 0x2D, 0x84, 0x58, 0x56, 0x70, 0x7E, 0x9C, 0x50, 0x23,
-0x6A, 0xD5, 0x49, 0xAA, 0x64, 0x66, 0x66, 0x86, 0x75, 0x34, 0xAA, 0xAF, 0xAF, 0x8F, 0x3C, 0x78,
-0x38, 0x1F, 0xA8, 0xAD, 0xAD, 0x8D, 0x2C, 0x92, 0xC1, 0x3A, 0xCE, 0x07, 0x32, 0x03, 0xB9, 0x70,
-0x3E, 0x46, 0xA1, 0x36, 0x23, 0xD2, 0xC8, 0xFD, 0xFD, 0xFD, 0x6C, 0x10, 0x5D, 0xFA, 0x14, 0xE2,
-0x50, 0x8F, 0xF3, 0xAC, 0x0F, 0xFE, 0xCB, 0x56, 0xC8, 0x66, 0x02, 0x62, 0xCA, 0xB0, 0xDA, 0x84,
-0x51, 0x8B, 0x0C, 0xE9, 0x3D, 0xC1, 0xA5, 0xA5, 0x25, 0x71, 0x7F, 0x7F, 0x2F, 0xEA, 0xEA, 0xEA,
-0x68, 0x49, 0x22, 0xEA, 0x55, 0x1A, 0xB5, 0x92, 0xD9, 0xDC, 0xDC, 0xA4, 0x56, 0x22, 0xEA, 0x39,
-0x07, 0xB5, 0xE4, 0xC8, 0x6C, 0x64, 0x31, 0x81, 0x2C, 0x17, 0xE4, 0x8E, 0x1A, 0x50, 0x8B, 0x0C,
-0xD3, 0x9B, 0xA2, 0x45, 0x45, 0x45, 0x42, 0xBD, 0x12, 0xA3, 0x6F, 0x89, 0xA8, 0x7B, 0x5A, 0x6A,
-0x25, 0xA3, 0x9F, 0xE1, 0x19, 0x69, 0x6F, 0x6F, 0xA7, 0x96, 0x1C, 0x99, 0x8D, 0x2C, 0x26, 0x90,
-0xE5, 0x82, 0xDC, 0x51, 0x83, 0x19, 0xB6, 0x1F, 0x8C, 0xFC, 0xAD, 0x98, 0x0E, 0xC0, 0xC3, 0xC3,
-0x83, 0x08, 0x87, 0xC3, 0xF4, 0x2D, 0x91, 0x58, 0x2C, 0x46, 0xAD, 0x64, 0x70, 0x6E, 0xCF, 0xB1,
-0xB1, 0xB1, 0x41, 0x2D, 0x39, 0x32, 0x1B, 0x59, 0x4C, 0x20, 0xCB, 0x05, 0xB9, 0xA3, 0x06, 0x53,
-0x68, 0x5F, 0x90, 0x44, 0x50, 0x76, 0x82, 0xFF, 0x0E, 0x83, 0xF4, 0x19, 0xEC, 0x13, 0x21, 0xAB,
-0x29, 0x14, 0xAF, 0xBF, 0xEE, 0x54, 0x38, 0xF0, 0x17, 0x43, 0x76, 0xA6, 0xFD, 0xDF, 0x7A, 0x39,
-0xAC, 0xDD, 0x0A, 0x08, 0xFC, 0x0D, 0x91, 0x20, 0xDF, 0x12, 0x43, 0xED, 0xFF, 0x6E, 0x8A, 0x62,
-0x00, 0x82, 0x7C, 0x5B, 0xFC, 0xEB, 0x80, 0x1E, 0xE8, 0x07, 0x23, 0x20, 0xF0, 0x8F, 0xC6, 0x40,
-0xA0, 0x1F, 0x8E, 0xEA, 0x70, 0x4E, 0xD0, 0x4F, 0x3C, 0x1E, 0x3F, 0x3D, 0x3D, 0xFD, 0xDE, 0xC7,
-0xE3, 0xC0, 0xEC, 0xB0, 0x98, 0xEA, 0x0B, 0x12, 0xA1, 0x50, 0x48, 0xF3, 0x73, 0xC2, 0x8F, 0xBD,
-0x20, 0x01, 0x02, 0xFD, 0x8A, 0x0C, 0x08, 0xFC, 0x4B, 0x52, 0x20, 0xD0, 0xAF, 0xC9, 0x81, 0xC0,
-0xBF, 0x28, 0x09, 0x26, 0x26, 0x26, 0xD8, 0x80, 0xBA, 0xF2, 0xF2, 0xF2, 0x94, 0xE3, 0xE3, 0x63,
-0xB2, 0xFE, 0x43, 0x38, 0x1C, 0x66, 0xED, 0xDD, 0x0C, 0x00, 0x62, 0x1A, 0x41, 0xDF, 0xC8, 0x81,
-0xB3, 0xD7, 0x15, 0x89, 0x44, 0xC8, 0x9A, 0xC7, 0x74, 0x00, 0x00, 0x17, 0x14, 0x0A, 0xC4, 0xCB,
-0xD2, 0xC0, 0x78, 0x3F, 0x7E, 0x78, 0x78, 0x18, 0x51, 0x85, 0x7A, 0xD2, 0x44, 0x4B, 0x7E, 0x1E,
-0xE4, 0x82, 0x9C, 0x90, 0x5B, 0x3C, 0x78, 0xD5, 0xDF, 0x12, 0x6D, 0x18, 0x6C, 0x70, 0x7D, 0x7D,
-0x4D, 0x2D, 0x6B, 0xBE, 0x7B, 0x06, 0x18, 0x71, 0x92, 0xAB, 0xED, 0x07, 0x23, 0x65, 0x65, 0x65,
-0xD4, 0x4A, 0x9D, 0x92, 0x92, 0x12, 0x6A, 0xC9, 0xB1, 0x63, 0x63, 0x85, 0x93, 0x5C, 0xBF, 0xF5,
-0xC9, 0x10, 0x7E, 0x14, 0x55, 0x55, 0x55, 0xA5, 0x7D, 0x72, 0xD2, 0xD7, 0x7D, 0x2B, 0x34, 0x13,
-0x3C, 0x45, 0xB6, 0x09, 0xB8, 0x91, 0x93, 0x4D, 0xC0, 0x09, 0xBE, 0xCC, 0x00, 0xF5, 0xB8, 0x4B,
-0x2D, 0xEF, 0xF0, 0x23, 0x26, 0xF0, 0x65, 0x00, 0xD4, 0x6B, 0x09, 0x6A, 0x79, 0x87, 0x7A, 0x2E,
-0x4F, 0x2D, 0x8F, 0xA1, 0x99, 0xE0, 0x29, 0x7B, 0x7B, 0x7B, 0xEC, 0x34, 0x76, 0xA3, 0x5F, 0xF5,
-0xE3, 0x69, 0xF0, 0x3B, 0x7E, 0x3E, 0xAF, 0x28, 0xFF, 0x01, 0x59, 0x8D, 0xA7, 0xF3, 0x33, 0xB6,
-0x8D, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-unsigned char mortar_yellow[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x08, 0x06, 0x00, 0x00, 0x00, 0x56, 0xCE, 0x8E,
-0x57, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE,
-0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B,
-0xFC, 0x61, 0x05, 0x00, 0x00, 0x00, 0xFD, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x9D, 0x94, 0xE1,
-0x11, 0x82, 0x30, 0x0C, 0x85, 0x53, 0xCF, 0xFF, 0xE2, 0x06, 0xDD, 0x40, 0x9C, 0x40, 0x47, 0x70,
-0x03, 0xEA, 0x06, 0x6C, 0x20, 0x1B, 0xC8, 0x06, 0xB8, 0x09, 0x6E, 0xC0, 0x39, 0x01, 0x6C, 0x00,
-0x1B, 0xD4, 0x57, 0x4D, 0x3D, 0x29, 0xE5, 0xA0, 0xCD, 0xDD, 0x77, 0x2D, 0xBD, 0xE4, 0x5D, 0xD2,
-0x34, 0x08, 0x8A, 0x30, 0xAD, 0x49, 0x62, 0xA9, 0xC0, 0x0B, 0x74, 0x42, 0x50, 0xB9, 0xA1, 0x38,
-0xBB, 0x80, 0x33, 0xD8, 0x81, 0x13, 0x84, 0x53, 0x0A, 0x35, 0x04, 0x65, 0xA0, 0x01, 0x25, 0xD0,
-0xE0, 0xCE, 0x19, 0x06, 0x89, 0xA4, 0xA0, 0x67, 0x81, 0x0A, 0xD4, 0xBC, 0x97, 0x21, 0x22, 0x12,
-0xB4, 0x1C, 0x68, 0x29, 0x80, 0x0A, 0x11, 0x49, 0x3C, 0x22, 0x6D, 0x4C, 0x49, 0xB5, 0x23, 0xD2,
-0x07, 0x5F, 0x30, 0x5F, 0xA6, 0x76, 0x50, 0xAE, 0xDF, 0x66, 0x41, 0xE4, 0x86, 0x25, 0x77, 0x8E,
-0x1F, 0xF4, 0x6D, 0xFB, 0xEA, 0x4C, 0x32, 0x4F, 0x26, 0xA5, 0x6D, 0xFD, 0xAA, 0x8C, 0xB8, 0x7E,
-0xD7, 0xF9, 0x09, 0x7A, 0x90, 0x70, 0x56, 0x23, 0x13, 0x4E, 0x70, 0xC2, 0x9F, 0x07, 0xB0, 0x07,
-0x19, 0x90, 0xA0, 0x03, 0x47, 0x8C, 0xC2, 0x60, 0x3A, 0x88, 0xBD, 0x32, 0x63, 0x41, 0x9E, 0x0C,
-0x94, 0xA7, 0x0C, 0xFB, 0x4E, 0x1A, 0xB7, 0xCD, 0xF8, 0xCE, 0x59, 0x70, 0x22, 0x54, 0xCF, 0x08,
-0xB5, 0xBE, 0x00, 0x7E, 0x57, 0xA3, 0x26, 0x6C, 0xFF, 0xF6, 0x1D, 0x4D, 0xCD, 0x4C, 0xF6, 0xE0,
-0x1E, 0x72, 0x89, 0x06, 0x89, 0xFD, 0x27, 0x4E, 0x98, 0x99, 0xA1, 0x05, 0x83, 0xF3, 0xD5, 0x97,
-0x15, 0x96, 0x82, 0x6C, 0x53, 0x66, 0x4A, 0x1A, 0xE1, 0x13, 0xE7, 0xFB, 0xFB, 0xF9, 0xC4, 0xFE,
-0x8F, 0x26, 0xF6, 0x06, 0x90, 0xBC, 0x06, 0xB7, 0xC8, 0xA9, 0x21, 0x8B, 0x00, 0x00, 0x00, 0x00,
-0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-unsigned char mortar_green[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x08, 0x06, 0x00, 0x00, 0x00, 0x56, 0xCE, 0x8E,
-0x57, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE,
-0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B,
-0xFC, 0x61, 0x05, 0x00, 0x00, 0x01, 0x5D, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x9D, 0x94, 0xC1,
-0x51, 0xC2, 0x40, 0x14, 0x86, 0xBF, 0x80, 0xE3, 0x38, 0x5E, 0xC0, 0x0E, 0xB0, 0x02, 0xB5, 0x02,
-0xB5, 0x02, 0xA5, 0x82, 0xE0, 0x41, 0x0D, 0x27, 0xB5, 0x02, 0xA1, 0x02, 0xE1, 0xC6, 0xE0, 0xC1,
-0x74, 0x60, 0x09, 0xD8, 0x81, 0xDA, 0x01, 0x1D, 0x88, 0x17, 0xCD, 0x38, 0x23, 0xF8, 0xEF, 0x06,
-0x88, 0xD9, 0x44, 0x09, 0xF9, 0x67, 0xDE, 0x2E, 0x79, 0xD9, 0xFD, 0xF6, 0xED, 0x7B, 0x8F, 0x78,
-0x94, 0x51, 0x40, 0x43, 0xE3, 0x03, 0x33, 0x5E, 0x65, 0x63, 0x86, 0xF4, 0x2A, 0x94, 0x91, 0xC7,
-0xA9, 0xC6, 0x23, 0xCD, 0x35, 0xD9, 0x21, 0xE7, 0xEC, 0xAF, 0x0F, 0x6A, 0xE3, 0x6B, 0xF4, 0x15,
-0x49, 0x5F, 0x73, 0x8B, 0x8A, 0x22, 0xAA, 0x32, 0xF1, 0xD6, 0x82, 0xE8, 0x64, 0x6D, 0x1C, 0x29,
-0x8A, 0xBA, 0x9E, 0x42, 0x59, 0xC3, 0x46, 0x06, 0xBB, 0xC5, 0x41, 0x71, 0x5E, 0x46, 0xF3, 0xCD,
-0x0B, 0x75, 0x65, 0x63, 0x06, 0x84, 0xC5, 0x40, 0xD7, 0x8A, 0x20, 0xE2, 0xD9, 0x81, 0x8C, 0x65,
-0xC7, 0x82, 0x98, 0x99, 0x8D, 0x42, 0xA0, 0x88, 0xC7, 0x14, 0x64, 0xC6, 0x84, 0x29, 0x4D, 0xEE,
-0x63, 0x88, 0xD1, 0xEA, 0x64, 0x5F, 0x72, 0x47, 0x9C, 0x87, 0x44, 0x1E, 0x37, 0x82, 0xBC, 0xFC,
-0x76, 0xFD, 0x1F, 0x51, 0xC0, 0x2D, 0xE6, 0x62, 0x69, 0x85, 0x8A, 0xA8, 0xE6, 0x2E, 0xFD, 0x1B,
-0xD4, 0xB6, 0x25, 0xEE, 0x38, 0xDE, 0xBE, 0xED, 0x1B, 0x78, 0x77, 0x97, 0xE7, 0x5F, 0xCD, 0x94,
-0x79, 0x4A, 0xCF, 0xF1, 0x3E, 0xC9, 0xDE, 0x04, 0xAF, 0xF3, 0x6D, 0x4B, 0x9F, 0x92, 0x97, 0xDA,
-0x5C, 0xB5, 0xFD, 0x61, 0x92, 0xB9, 0xA7, 0x37, 0x3B, 0x60, 0x9B, 0xAF, 0x81, 0xA9, 0xD0, 0x16,
-0x07, 0x42, 0x4F, 0xD4, 0x82, 0x75, 0x36, 0x35, 0x0E, 0xD3, 0x07, 0xC5, 0xA0, 0x40, 0x2F, 0xCC,
-0x7F, 0x27, 0xAB, 0xAE, 0x56, 0x9C, 0x08, 0xDC, 0x5C, 0x94, 0xD9, 0xEA, 0x42, 0x79, 0xDB, 0x56,
-0x54, 0x06, 0xEC, 0x5C, 0xCD, 0x27, 0x5F, 0x3E, 0x9F, 0x49, 0xAF, 0x2C, 0xF5, 0x25, 0xC8, 0x87,
-0x3D, 0x1C, 0x17, 0x04, 0x71, 0x83, 0x65, 0x2D, 0x4C, 0x4E, 0x5D, 0xCA, 0xF8, 0x2A, 0xB2, 0x20,
-0xE9, 0x2D, 0x4F, 0x0F, 0x79, 0x57, 0x4A, 0x6B, 0xC0, 0x59, 0xC6, 0x17, 0x77, 0x7B, 0x47, 0xBF,
-0x6C, 0xAE, 0x4C, 0xF9, 0x5B, 0xAC, 0x56, 0x16, 0x14, 0xD9, 0xFE, 0xBA, 0x9A, 0x1B, 0xE5, 0xBE,
-0x47, 0x39, 0xFA, 0x01, 0x4D, 0xA3, 0x55, 0xF6, 0x54, 0x47, 0xD8, 0x9C, 0x00, 0x00, 0x00, 0x00,
-0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-unsigned char mortar_red[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x08, 0x06, 0x00, 0x00, 0x00, 0x56, 0xCE, 0x8E,
-0x57, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE,
-0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B,
-0xFC, 0x61, 0x05, 0x00, 0x00, 0x00, 0xF8, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x9D, 0x94, 0xED,
-0x0D, 0x82, 0x30, 0x10, 0x86, 0xAF, 0xC6, 0xFF, 0xEA, 0x06, 0x6C, 0x20, 0x4E, 0xA0, 0x23, 0xB8,
-0x01, 0x38, 0x81, 0x6C, 0x20, 0x1B, 0xC8, 0x06, 0x8C, 0xC2, 0x08, 0xC4, 0x09, 0xCA, 0x06, 0xB0,
-0x41, 0x7D, 0x1B, 0xAE, 0x5A, 0xE0, 0x30, 0xB6, 0x97, 0x3C, 0x69, 0x0B, 0xBD, 0x97, 0xFB, 0x28,
-0x55, 0x14, 0x61, 0x86, 0x28, 0xC1, 0x50, 0x83, 0x17, 0xE8, 0x14, 0x51, 0xB5, 0xA1, 0x38, 0xBB,
-0x82, 0x0B, 0xD8, 0x81, 0x33, 0x84, 0x53, 0x0A, 0x35, 0x38, 0x65, 0xA0, 0x05, 0x15, 0x30, 0xE0,
-0xC9, 0x11, 0x06, 0x89, 0xA4, 0xA0, 0x67, 0x81, 0x1A, 0x34, 0x3C, 0x4F, 0x42, 0x44, 0x12, 0xA0,
-0xD9, 0xD1, 0x51, 0x82, 0x3C, 0x44, 0x64, 0x2F, 0x88, 0xE8, 0x98, 0x94, 0x9A, 0x99, 0x48, 0x1F,
-0x5C, 0x60, 0x2E, 0xA6, 0x99, 0x91, 0x87, 0x68, 0x58, 0x91, 0x87, 0x20, 0x62, 0x8B, 0x7C, 0x0F,
-0x11, 0xC9, 0x04, 0x91, 0xCA, 0xB5, 0xFE, 0x5F, 0x11, 0xBF, 0xCD, 0x8E, 0x86, 0x23, 0xD4, 0x52,
-0x7D, 0x94, 0xEF, 0x8C, 0x61, 0xCF, 0xCB, 0x23, 0x38, 0x80, 0x8C, 0xC6, 0xCE, 0x74, 0xE0, 0x84,
-0xCD, 0x83, 0x19, 0xF7, 0xE4, 0x4A, 0x8A, 0xCA, 0x16, 0x4F, 0x48, 0xC3, 0x9D, 0x93, 0x76, 0xDE,
-0x66, 0xAC, 0x0B, 0xF3, 0xFD, 0xE8, 0xE4, 0x45, 0xB3, 0x22, 0xA4, 0x25, 0x07, 0x3E, 0x57, 0x85,
-0xFF, 0x6C, 0xEB, 0xCD, 0x3B, 0x5A, 0x9A, 0xFD, 0xB3, 0x07, 0x5A, 0xD6, 0xC3, 0xA6, 0x68, 0x49,
-0x14, 0xFB, 0x29, 0x33, 0x5E, 0x07, 0x3F, 0x0D, 0x9B, 0x6F, 0x52, 0x54, 0x18, 0x4A, 0x72, 0xB5,
-0x5A, 0x49, 0x69, 0x82, 0x24, 0xCE, 0xF5, 0xFB, 0xEC, 0x89, 0xBD, 0x8F, 0x16, 0xF6, 0x06, 0xF2,
-0x91, 0xC1, 0x1F, 0x67, 0xF7, 0x79, 0x34, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE,
-0x42, 0x60, 0x82
-};
-
-unsigned char mortar_blue[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x08, 0x06, 0x00, 0x00, 0x00, 0x56, 0xCE, 0x8E,
-0x57, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE,
-0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B,
-0xFC, 0x61, 0x05, 0x00, 0x00, 0x01, 0x69, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x9D, 0x94, 0xCD,
-0x51, 0xC3, 0x30, 0x10, 0x85, 0x9F, 0xEC, 0x4C, 0x0E, 0x5C, 0x30, 0x1D, 0x84, 0x0A, 0x80, 0x0A,
-0x48, 0x2A, 0x00, 0x2A, 0xB0, 0x39, 0x84, 0x9F, 0x53, 0x4C, 0x05, 0x90, 0x0A, 0x30, 0x37, 0x7E,
-0x0E, 0x71, 0x07, 0x94, 0x00, 0x1D, 0x00, 0x1D, 0xA8, 0x03, 0xCC, 0x81, 0x30, 0xC3, 0x10, 0x8B,
-0xB7, 0xF2, 0x10, 0x22, 0xDB, 0x99, 0x38, 0x7E, 0x33, 0xD2, 0xC8, 0x6B, 0xEF, 0xA7, 0xD5, 0xEE,
-0xCA, 0x0A, 0x6D, 0x74, 0x66, 0x7A, 0x30, 0x98, 0x20, 0xC7, 0x1B, 0x14, 0x34, 0xEE, 0x55, 0xE2,
-0xA1, 0x8D, 0x72, 0x1C, 0x12, 0xD4, 0xE7, 0x6A, 0x93, 0x63, 0x1F, 0x43, 0xB3, 0xBB, 0x3E, 0xE8,
-0xDC, 0x84, 0x9C, 0x43, 0x82, 0x6E, 0x18, 0x4D, 0xC4, 0xB5, 0x86, 0x8F, 0x4C, 0xAD, 0xC3, 0x90,
-0x9D, 0x39, 0x3F, 0x11, 0x10, 0x10, 0x94, 0xC2, 0x43, 0xCF, 0x46, 0xE6, 0x61, 0xBB, 0x39, 0x48,
-0xF2, 0x92, 0x13, 0x02, 0x3A, 0xFF, 0x6B, 0x4C, 0x88, 0xC6, 0xAD, 0x4A, 0x9B, 0x81, 0x62, 0x13,
-0x60, 0x8A, 0x97, 0x12, 0x44, 0x13, 0x32, 0x20, 0x44, 0xCB, 0x43, 0xB3, 0x1C, 0x7D, 0xE2, 0xD1,
-0x81, 0x18, 0x64, 0x1C, 0x47, 0x7F, 0x90, 0x66, 0xA0, 0x13, 0x73, 0xCD, 0x9C, 0xF4, 0x1D, 0x9B,
-0x8F, 0x0B, 0x3C, 0xA8, 0xD7, 0x45, 0x93, 0xB7, 0x02, 0x72, 0xC9, 0x39, 0x76, 0x6C, 0x8A, 0x49,
-0x9E, 0xD9, 0xB2, 0x3B, 0xEA, 0x2C, 0x85, 0x48, 0x99, 0x67, 0xB8, 0x72, 0x6C, 0x52, 0x72, 0xE9,
-0x1B, 0xE0, 0xA3, 0xFC, 0x79, 0x7D, 0x44, 0x52, 0xE6, 0x1F, 0x24, 0x25, 0xC8, 0x33, 0xA3, 0x79,
-0xE7, 0x2A, 0xE0, 0x48, 0xCB, 0x2E, 0xCA, 0x71, 0xF6, 0xED, 0x47, 0x60, 0x24, 0x3B, 0x7C, 0xB3,
-0x05, 0x69, 0xBC, 0x22, 0xC9, 0x1A, 0x1B, 0xD8, 0x43, 0xA2, 0x32, 0x44, 0xAC, 0x60, 0x97, 0x8D,
-0xC8, 0x6B, 0x51, 0x05, 0x0D, 0x4D, 0xC4, 0xD5, 0x04, 0x55, 0x8D, 0x39, 0x0E, 0x18, 0xB7, 0x53,
-0x21, 0xE6, 0x2E, 0xC6, 0x37, 0xA3, 0x4A, 0x09, 0x76, 0x8E, 0xE6, 0xD9, 0x9D, 0xEB, 0x14, 0xD2,
-0x61, 0xE0, 0x40, 0x44, 0x02, 0xE9, 0xDA, 0xEB, 0x01, 0x17, 0x54, 0x48, 0x57, 0x86, 0xDC, 0xEC,
-0x85, 0x5D, 0xE7, 0x12, 0x9B, 0xF4, 0x92, 0x74, 0xFB, 0xFC, 0x68, 0xA7, 0xA6, 0xEE, 0x48, 0xAE,
-0xEE, 0xD4, 0x71, 0xC5, 0x26, 0xDD, 0xFE, 0xC5, 0xAA, 0xAA, 0xA2, 0x28, 0x1D, 0x92, 0x23, 0xAC,
-0x56, 0x15, 0x34, 0xB5, 0xFD, 0x35, 0xA2, 0xFF, 0x48, 0x1E, 0xDB, 0xFD, 0x8F, 0x6A, 0xF4, 0x0B,
-0x19, 0xAA, 0x6D, 0xEE, 0x6F, 0xC8, 0xF8, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44,
-0xAE, 0x42, 0x60, 0x82
-};
-
-unsigned char target_yellow[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x08, 0x06, 0x00, 0x00, 0x00, 0x56, 0xCE, 0x8E,
-0x57, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE,
-0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B,
-0xFC, 0x61, 0x05, 0x00, 0x00, 0x00, 0xD4, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xBD, 0x93, 0x81,
-0x0D, 0x83, 0x30, 0x0C, 0x04, 0xDD, 0x2E, 0x50, 0x46, 0xC8, 0x08, 0x19, 0xA1, 0x1D, 0xA1, 0x13,
-0x41, 0x37, 0x60, 0x83, 0xD0, 0x09, 0x18, 0x81, 0x11, 0x3A, 0x02, 0x62, 0x02, 0xBA, 0x01, 0x7D,
-0x4B, 0x8F, 0x14, 0x45, 0xD4, 0x01, 0x5A, 0x61, 0xE9, 0x44, 0x88, 0xDF, 0xC6, 0x8E, 0x83, 0xC8,
-0x51, 0x36, 0x4D, 0xE2, 0xC1, 0x55, 0x7E, 0x35, 0x24, 0x69, 0x41, 0x2D, 0x7B, 0x0C, 0x81, 0x4E,
-0x83, 0xC1, 0x08, 0x26, 0xA2, 0xEB, 0xA0, 0xBE, 0xA5, 0x98, 0xF3, 0x42, 0x12, 0x8F, 0xC7, 0x0B,
-0x5C, 0xC0, 0x1D, 0x3C, 0xC1, 0x03, 0xDC, 0xC0, 0x09, 0x74, 0xD4, 0x64, 0x2B, 0xE9, 0x41, 0x95,
-0xEC, 0xB9, 0xE8, 0xBD, 0x62, 0x75, 0xCE, 0x4A, 0xD4, 0x68, 0xF9, 0x92, 0x31, 0xEA, 0x6A, 0x4B,
-0x30, 0xAE, 0x99, 0x90, 0x6A, 0x54, 0xFB, 0xCD, 0xD1, 0xF2, 0x50, 0x83, 0x55, 0x36, 0x5B, 0x0D,
-0xD4, 0xB6, 0xF3, 0x79, 0xCD, 0x87, 0xFD, 0x06, 0x03, 0xD7, 0x83, 0xE4, 0xCD, 0xD6, 0x6E, 0x6C,
-0xAD, 0xB7, 0x04, 0x3A, 0x91, 0x4E, 0xF2, 0x89, 0xEC, 0xA1, 0xC0, 0x59, 0x70, 0xFC, 0x65, 0xB4,
-0x97, 0x8E, 0xBF, 0xA4, 0xC6, 0x49, 0xE6, 0x6B, 0x9E, 0xC2, 0xC0, 0x16, 0x1A, 0xDE, 0x72, 0x5D,
-0x77, 0xF4, 0xD9, 0x17, 0x32, 0xA9, 0xA2, 0x61, 0x50, 0xFC, 0x8B, 0x68, 0xEB, 0x85, 0xEC, 0xB1,
-0xEC, 0xE5, 0xDB, 0x90, 0xC8, 0xAF, 0x6E, 0xE5, 0x1F, 0xF6, 0x01, 0xBB, 0x71, 0xCB, 0xBE, 0xE2,
-0x6A, 0xE3, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-unsigned char target_green[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x08, 0x06, 0x00, 0x00, 0x00, 0x56, 0xCE, 0x8E,
-0x57, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE,
-0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B,
-0xFC, 0x61, 0x05, 0x00, 0x00, 0x01, 0x32, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xBD, 0x93, 0x3B,
-0x4E, 0xC3, 0x40, 0x10, 0x86, 0xBF, 0x90, 0x14, 0x74, 0x70, 0x04, 0x1F, 0x01, 0x04, 0x48, 0x74,
-0x31, 0x27, 0x80, 0x9C, 0x00, 0x1A, 0x84, 0x3B, 0xB8, 0x81, 0xC3, 0x09, 0x48, 0x3A, 0x24, 0x0A,
-0x92, 0x13, 0x90, 0x1B, 0xC0, 0x01, 0x10, 0x8F, 0x92, 0x0A, 0xDC, 0xD1, 0x41, 0x49, 0x03, 0x66,
-0x66, 0xBD, 0x48, 0x6B, 0x6B, 0xED, 0x69, 0x50, 0x7E, 0x69, 0xC7, 0xEB, 0xF1, 0x3F, 0xEF, 0x31,
-0x2C, 0x0D, 0xC7, 0x6C, 0x90, 0x91, 0x5A, 0xB4, 0x15, 0x8B, 0xC0, 0x80, 0x5C, 0xE4, 0x81, 0x45,
-0xEB, 0x45, 0xB5, 0x19, 0x89, 0xC8, 0x33, 0x4A, 0x0E, 0x85, 0xB1, 0xEE, 0x74, 0x25, 0x9F, 0x72,
-0x5F, 0xC8, 0xED, 0x9C, 0x4B, 0xDE, 0xEC, 0x8C, 0xB4, 0x94, 0x92, 0x47, 0xB9, 0xAD, 0x89, 0xE1,
-0x48, 0x9E, 0x73, 0x67, 0xFC, 0xC3, 0x9E, 0x0F, 0x7C, 0xEB, 0x38, 0x9D, 0xD0, 0x4C, 0x32, 0x5E,
-0xE5, 0x8C, 0x1B, 0xBA, 0x24, 0x78, 0x1F, 0x73, 0xC2, 0x47, 0x4D, 0x17, 0x71, 0x34, 0x93, 0x73,
-0x8D, 0x85, 0x8A, 0x37, 0x09, 0x55, 0xF5, 0xD2, 0x4A, 0xF6, 0x7D, 0x29, 0x16, 0x66, 0xAE, 0x7F,
-0x01, 0xFA, 0x3E, 0x42, 0xCA, 0x16, 0x17, 0xD2, 0x81, 0xAA, 0xF6, 0x6D, 0x9E, 0xB9, 0x97, 0xE6,
-0xC6, 0xB3, 0x49, 0x44, 0x9E, 0x0A, 0x77, 0x97, 0x1D, 0xE1, 0x6F, 0xF2, 0xC2, 0x03, 0xEF, 0x55,
-0x46, 0xDF, 0xCE, 0xA8, 0xF0, 0xD4, 0x02, 0x1B, 0x85, 0xAF, 0xA0, 0x85, 0x5B, 0x35, 0x31, 0xC5,
-0x82, 0x72, 0x74, 0x28, 0x01, 0xEA, 0x3D, 0xEA, 0x31, 0x15, 0x99, 0x63, 0xE3, 0x48, 0xCE, 0x5D,
-0xBB, 0xA3, 0x2F, 0x37, 0x09, 0x1D, 0x77, 0x1E, 0x44, 0x6F, 0x8E, 0x5F, 0xBF, 0x0D, 0xD1, 0xDD,
-0xAA, 0xE5, 0xD0, 0x84, 0x2E, 0x5B, 0x9F, 0x1B, 0x1F, 0x71, 0xEE, 0xA3, 0x6B, 0x0F, 0x17, 0x3E,
-0xDB, 0x44, 0x7A, 0x3A, 0xE2, 0x8A, 0xA7, 0x6E, 0x47, 0x7F, 0x59, 0xE0, 0x96, 0x72, 0xE8, 0x0C,
-0x15, 0xD5, 0x2F, 0x32, 0x65, 0x55, 0xB2, 0x9E, 0xB4, 0x4C, 0xB4, 0x13, 0x91, 0xE5, 0x8B, 0x61,
-0x60, 0x11, 0xA4, 0x0C, 0xD3, 0xC9, 0xBF, 0xE2, 0x17, 0xB4, 0xAD, 0x4A, 0x3C, 0x3E, 0xD5, 0x6E,
-0x23, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-unsigned char target_red[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x08, 0x06, 0x00, 0x00, 0x00, 0x56, 0xCE, 0x8E,
-0x57, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE,
-0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B,
-0xFC, 0x61, 0x05, 0x00, 0x00, 0x00, 0xD4, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xBD, 0x93, 0x81,
-0x0D, 0x83, 0x30, 0x0C, 0x04, 0xDD, 0x2E, 0x50, 0x46, 0xC8, 0x08, 0x19, 0xA1, 0x1D, 0xA1, 0x13,
-0x41, 0x37, 0x60, 0x83, 0xD0, 0x09, 0x18, 0x81, 0x11, 0x3A, 0x02, 0x62, 0x02, 0xBA, 0x01, 0x7D,
-0x4B, 0x8F, 0x14, 0x45, 0xD4, 0x01, 0x5A, 0x61, 0xE9, 0x44, 0x88, 0xDF, 0xC6, 0x8E, 0x83, 0xC8,
-0x51, 0x36, 0x89, 0x78, 0x70, 0x95, 0x5F, 0x0D, 0x49, 0x5A, 0x50, 0xCB, 0x1E, 0x43, 0xA0, 0xD3,
-0x60, 0x30, 0x82, 0x89, 0xE8, 0x3A, 0xA8, 0x6F, 0x29, 0xE6, 0xBC, 0x90, 0xC4, 0xE3, 0xF1, 0x02,
-0x17, 0x70, 0x07, 0x4F, 0xF0, 0x00, 0x37, 0x70, 0x02, 0x1D, 0x35, 0xD9, 0x4A, 0x7A, 0x50, 0x25,
-0x7B, 0x2E, 0x7A, 0xAF, 0x58, 0x9D, 0xB3, 0x12, 0x35, 0x5A, 0xBE, 0x64, 0x8C, 0xBA, 0xDA, 0x12,
-0x8C, 0x6B, 0x26, 0xA4, 0x1A, 0xD5, 0x7E, 0x73, 0xB4, 0x3C, 0xD4, 0x60, 0x95, 0xCD, 0x56, 0x03,
-0xB5, 0xED, 0x7C, 0x5E, 0xF3, 0x61, 0xBF, 0xC1, 0xC0, 0xF5, 0x20, 0x79, 0xB3, 0xB5, 0x1B, 0x5B,
-0xEB, 0x2D, 0x81, 0x4E, 0xA4, 0x93, 0x7C, 0x22, 0x7B, 0x28, 0x70, 0x16, 0x1C, 0x7F, 0x19, 0xED,
-0xA5, 0xE3, 0x2F, 0xA9, 0x71, 0x92, 0xF9, 0x9A, 0xA7, 0x30, 0xB0, 0x85, 0x86, 0xB7, 0x5C, 0xD7,
-0x1D, 0x7D, 0xF6, 0x85, 0x4C, 0xAA, 0x68, 0x18, 0x14, 0xFF, 0x22, 0xDA, 0x7A, 0x21, 0x7B, 0x2C,
-0x7B, 0xF9, 0x36, 0x24, 0xF2, 0xAB, 0x5B, 0xF9, 0x87, 0x7D, 0x00, 0xF1, 0xBE, 0x7E, 0x0C, 0x3F,
-0xAC, 0x7E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-unsigned char target_blue[] =
-{
-0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x08, 0x06, 0x00, 0x00, 0x00, 0x56, 0xCE, 0x8E,
-0x57, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE,
-0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B,
-0xFC, 0x61, 0x05, 0x00, 0x00, 0x01, 0x2C, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xBD, 0x52, 0xC1,
-0x71, 0xC2, 0x40, 0x0C, 0xDC, 0x83, 0xBC, 0xF2, 0x09, 0x25, 0x50, 0x42, 0x3A, 0x08, 0xA9, 0x20,
-0x49, 0x05, 0xE4, 0x11, 0x3B, 0x79, 0xA6, 0x03, 0x43, 0x07, 0xE6, 0x97, 0x99, 0x3C, 0x02, 0x15,
-0x40, 0x07, 0x49, 0x07, 0xA1, 0x03, 0xA0, 0x02, 0xFC, 0x66, 0x06, 0x8B, 0x95, 0x0C, 0x03, 0xC6,
-0x60, 0x0D, 0x1F, 0x76, 0x46, 0x63, 0xDF, 0xDD, 0xDE, 0x6A, 0x4F, 0x12, 0x70, 0x35, 0x44, 0x72,
-0x8F, 0x37, 0xE9, 0x78, 0xB4, 0x86, 0x47, 0x40, 0x40, 0x82, 0x26, 0x9E, 0x7D, 0xDA, 0x29, 0x7C,
-0x48, 0x1B, 0x82, 0x4F, 0xE4, 0xE8, 0x92, 0xD1, 0xB2, 0x3D, 0x41, 0xC6, 0xB4, 0x13, 0xAE, 0xFB,
-0xF8, 0x0A, 0x73, 0xDF, 0x91, 0x3E, 0x65, 0x8D, 0x7F, 0xFE, 0xDD, 0xF1, 0xF2, 0x0B, 0xBF, 0x23,
-0x46, 0x9F, 0xF1, 0xC8, 0x75, 0xA0, 0xF8, 0xAF, 0x71, 0x6A, 0xA1, 0x4E, 0x62, 0x99, 0x31, 0x7A,
-0xA5, 0x3D, 0x8D, 0x1D, 0xF4, 0x2C, 0x96, 0x65, 0x69, 0xAF, 0x82, 0x58, 0x86, 0x78, 0x97, 0x1F,
-0x78, 0x50, 0x5E, 0x24, 0x29, 0xCE, 0x3E, 0x4D, 0xF0, 0x44, 0xF3, 0x23, 0x57, 0x28, 0xC7, 0x90,
-0xBC, 0x6E, 0x55, 0x48, 0xDB, 0x1B, 0xCB, 0xD8, 0x0A, 0x2B, 0x24, 0xD4, 0xD9, 0xD6, 0xB3, 0xA6,
-0x89, 0xB4, 0xEC, 0xCE, 0xB6, 0x5E, 0x85, 0x50, 0x60, 0x47, 0x04, 0x8B, 0xAD, 0xAB, 0x05, 0x3C,
-0xB8, 0xDC, 0xC8, 0x8A, 0xD8, 0x81, 0x87, 0xE2, 0x05, 0xB3, 0xC3, 0xAD, 0x72, 0x8D, 0x02, 0x06,
-0xCC, 0x92, 0xC0, 0x43, 0x03, 0xAF, 0xE4, 0xFE, 0xE1, 0xAC, 0xD0, 0x0A, 0x29, 0x85, 0x74, 0x04,
-0xF6, 0x62, 0xD5, 0xF6, 0xEB, 0xD9, 0x83, 0x0D, 0x66, 0xC9, 0xC3, 0x31, 0xB4, 0x78, 0x01, 0x63,
-0xCB, 0xA8, 0x1D, 0xCC, 0x2D, 0x7B, 0xC6, 0x98, 0x70, 0x50, 0x13, 0x7E, 0xDB, 0x36, 0xA8, 0xDF,
-0x61, 0x5A, 0x2F, 0xB4, 0x73, 0x91, 0xA3, 0x67, 0x99, 0xC1, 0x8B, 0x0A, 0x31, 0xB1, 0x01, 0x6E,
-0xE9, 0x3A, 0x0D, 0x19, 0x2E, 0x46, 0x31, 0xA4, 0xA9, 0x47, 0xBB, 0xF1, 0x08, 0x74, 0xA2, 0x75,
-0xBB, 0x1E, 0x36, 0xDA, 0xCE, 0x75, 0x9E, 0xE2, 0x92, 0xC9, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x49,
-0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-
-};
\ No newline at end of file
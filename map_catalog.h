@@ -0,0 +1,43 @@
+﻿#pragma once
+
+// Каталог карт: одна запись на карту задает загрузку, превью, выбор и масштаб.
+// Записи строятся из таблицы пакета карт (map_pack.h); добавление карты - пересборка пакета.
+
+#include <cstddef>
+#include <cstdint>
+
+// Размер карты: задает масштаб и блок превью на главном экране
+enum class MapSizeClass {
+    Map2km,
+    Map4km
+};
+
+// Формат данных карты: PNG декодируется и нарезается в фоне,
+// готовая пирамида тайлов из пакета только проверяется и разбирается
+enum class MapDataFormat {
+    Png,
+    Pyramid
+};
+
+// Запись каталога
+struct MapRecord {
+    const char* name;
+    const unsigned char* data;
+    std::size_t size;
+    MapSizeClass sizeClass;
+    float scale;    // Метров на пиксель при исходном масштабе карты
+    float previewX; // Позиция превью на главном экране
+    float previewY;
+    const unsigned char* thumbnail = nullptr; // PNG миниатюры, если она есть в пакете
+    std::size_t thumbnailSize = 0;
+    std::uint32_t crc = 0; // CRC-32 данных карты; проверяется перед декодированием
+    MapDataFormat format = MapDataFormat::Png;
+};
+
+// Сторона изображения карты, для которой задан mapScaleFor (пиксели)
+constexpr unsigned mapReferenceSize = 900;
+
+// Масштаб (м на пиксель) для размера карты: 2км и 4км на mapReferenceSize пикселях
+constexpr float mapScaleFor(MapSizeClass sizeClass) {
+    return sizeClass == MapSizeClass::Map2km ? 2.2752f : 4.5504f;
+}
@@ -0,0 +1,283 @@
+﻿#include "map_pack.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char mapPackMagic[4] = { 'M', 'P', 'A', 'K' };
+static const std::uint16_t mapPackVersion = 2;
+static const std::size_t mapPackHeaderSize = 8;
+static const std::size_t mapPackEntrySize = 96;
+static const std::size_t mapPackNameSize = 48;
+static const std::uint64_t mapPackAlignment = 4096;
+
+// Таблица CRC-32 для полинома 0xEDB88320; строится один раз, в том числе при вызове из потоков декодирования
+struct CrcTable {
+    std::uint32_t values[256];
+
+    CrcTable() {
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t value = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+            }
+            values[i] = value;
+        }
+    }
+};
+
+// CRC-32 (IEEE 802.3)
+std::uint32_t crc32(const unsigned char* data, std::size_t size, std::uint32_t crc) {
+    static const CrcTable table;
+    crc = ~crc;
+    for (std::size_t i = 0; i < size; ++i) {
+        crc = table.values[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+// Отображение файла в память
+bool MappedFile::open(const std::string& path, std::string& error) {
+    close();
+#ifdef _WIN32
+    HANDLE handle = CreateFileW(std::filesystem::u8path(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        error = "Failed to open " + path;
+        return false;
+    }
+    file = handle;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(handle, &fileSize) || fileSize.QuadPart == 0) {
+        error = "Empty or unreadable file " + path;
+        close();
+        return false;
+    }
+    mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        error = "Failed to map " + path;
+        close();
+        return false;
+    }
+    bytes = static_cast<const unsigned char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!bytes) {
+        error = "Failed to map " + path;
+        close();
+        return false;
+    }
+    length = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        error = "Failed to open " + path;
+        return false;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || status.st_size == 0) {
+        error = "Empty or unreadable file " + path;
+        ::close(descriptor);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (view == MAP_FAILED) {
+        error = "Failed to map " + path;
+        return false;
+    }
+    bytes = static_cast<const unsigned char*>(view);
+    length = static_cast<std::size_t>(status.st_size);
+#endif
+    return true;
+}
+
+// Снятие отображения
+void MappedFile::close() {
+#ifdef _WIN32
+    if (bytes) {
+        UnmapViewOfFile(bytes);
+    }
+    if (mapping) {
+        CloseHandle(mapping);
+    }
+    if (file) {
+        CloseHandle(file);
+    }
+    mapping = nullptr;
+    file = nullptr;
+#else
+    if (bytes) {
+        munmap(const_cast<unsigned char*>(bytes), length);
+    }
+#endif
+    bytes = nullptr;
+    length = 0;
+}
+
+template <typename T>
+static T readValue(const unsigned char* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+template <typename T>
+static void appendValue(std::vector<unsigned char>& bytes, T value) {
+    unsigned char raw[sizeof(T)];
+    std::memcpy(raw, &value, sizeof(T));
+    bytes.insert(bytes.end(), raw, raw + sizeof(T));
+}
+
+// Отображение файла и чтение таблицы
+bool MapPack::open(const std::string& path, std::string& error) {
+    table.clear();
+    // Размер проверяется до отображения: вид больше предела в 32-битном процессе может не поместиться
+    std::error_code sizeError;
+    std::uint64_t fileSize = std::filesystem::file_size(std::filesystem::u8path(path), sizeError);
+    if (!sizeError && fileSize > mapPackMaxSize) {
+        error = path + ": map pack is " + std::to_string(fileSize >> 20) + " MB, more than the " +
+            std::to_string(mapPackMaxSize >> 20) + " MB limit; rebuild it with PNG maps";
+        return false;
+    }
+    if (!file.open(path, error)) {
+        return false;
+    }
+    const unsigned char* data = file.data();
+    std::size_t size = file.size();
+    if (size < mapPackHeaderSize || std::memcmp(data, mapPackMagic, 4) != 0) {
+        error = path + ": not a map pack";
+        return false;
+    }
+    std::uint16_t version = readValue<std::uint16_t>(data + 4);
+    if (version == 0 || version > mapPackVersion) {
+        error = path + ": unsupported map pack version";
+        return false;
+    }
+    std::size_t count = readValue<std::uint16_t>(data + 6);
+    if (size < mapPackHeaderSize + count * mapPackEntrySize) {
+        error = path + ": truncated map pack table";
+        return false;
+    }
+    table.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const unsigned char* record = data + mapPackHeaderSize + i * mapPackEntrySize;
+        MapPackEntry& entry = table[i];
+        const char* name = reinterpret_cast<const char*>(record);
+        entry.name.assign(name, strnlen(name, mapPackNameSize));
+        entry.sizeClass = record[48];
+        entry.column = record[49];
+        entry.row = record[50];
+        entry.format = version >= 2 ? record[51] : 0;
+        entry.scale = readValue<float>(record + 52);
+        entry.nudgeX = readValue<float>(record + 56);
+        entry.crc = readValue<std::uint32_t>(record + 60);
+        entry.offset = readValue<std::uint64_t>(record + 64);
+        entry.size = readValue<std::uint64_t>(record + 72);
+        entry.thumbnailOffset = readValue<std::uint64_t>(record + 80);
+        entry.thumbnailSize = readValue<std::uint32_t>(record + 88);
+        if (entry.offset > size || entry.size > size - entry.offset ||
+            entry.thumbnailOffset > size || entry.thumbnailSize > size - entry.thumbnailOffset) {
+            error = path + ": map " + entry.name + " lies outside the pack";
+            table.clear();
+            return false;
+        }
+        if (entry.format > 1) {
+            error = path + ": map " + entry.name + " has unknown data format";
+            table.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+// Запись пакета
+bool writeMapPack(const std::string& path, std::vector<MapPackSource>& maps, std::string& error) {
+    if (maps.size() > 0xFFFF) {
+        error = "Too many maps for one pack";
+        return false;
+    }
+
+    // Раскладка: таблица, миниатюры подряд, карты с границ страниц
+    std::uint64_t offset = mapPackHeaderSize + maps.size() * mapPackEntrySize;
+    for (MapPackSource& map : maps) {
+        map.entry.thumbnailOffset = offset;
+        map.entry.thumbnailSize = static_cast<std::uint32_t>(map.thumbnail.size());
+        offset += map.thumbnail.size();
+    }
+    for (MapPackSource& map : maps) {
+        offset = (offset + mapPackAlignment - 1) / mapPackAlignment * mapPackAlignment;
+        map.entry.offset = offset;
+        map.entry.size = map.data.size();
+        map.entry.crc = crc32(map.data.data(), map.data.size());
+        offset += map.data.size();
+    }
+    if (offset > mapPackMaxSize) {
+        error = "Map pack would be " + std::to_string(offset >> 20) + " MB, more than the " +
+            std::to_string(mapPackMaxSize >> 20) + " MB limit; store maps as PNG";
+        return false;
+    }
+
+    std::vector<unsigned char> header(mapPackMagic, mapPackMagic + 4);
+    appendValue(header, mapPackVersion);
+    appendValue(header, static_cast<std::uint16_t>(maps.size()));
+    for (const MapPackSource& map : maps) {
+        const MapPackEntry& entry = map.entry;
+        if (entry.name.empty() || entry.name.size() >= mapPackNameSize) {
+            error = "Map name must be 1.." + std::to_string(mapPackNameSize - 1) + " bytes: " + entry.name;
+            return false;
+        }
+        std::size_t start = header.size();
+        header.insert(header.end(), entry.name.begin(), entry.name.end());
+        header.resize(start + mapPackNameSize, 0);
+        header.push_back(entry.sizeClass);
+        header.push_back(entry.column);
+        header.push_back(entry.row);
+        header.push_back(entry.format);
+        appendValue(header, entry.scale);
+        appendValue(header, entry.nudgeX);
+        appendValue(header, entry.crc);
+        appendValue(header, entry.offset);
+        appendValue(header, entry.size);
+        appendValue(header, entry.thumbnailOffset);
+        appendValue(header, entry.thumbnailSize);
+        appendValue(header, std::uint32_t(0));
+    }
+
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        error = "Failed to create " + path;
+        return false;
+    }
+    output.write(reinterpret_cast<const char*>(header.data()), header.size());
+    for (const MapPackSource& map : maps) {
+        output.write(reinterpret_cast<const char*>(map.thumbnail.data()), map.thumbnail.size());
+    }
+    std::uint64_t written = header.size();
+    for (const MapPackSource& map : maps) {
+        written += map.thumbnail.size();
+    }
+    const std::vector<char> padding(mapPackAlignment, 0);
+    for (const MapPackSource& map : maps) {
+        output.write(padding.data(), static_cast<std::streamsize>(map.entry.offset - written));
+        output.write(reinterpret_cast<const char*>(map.data.data()), map.data.size());
+        written = map.entry.offset + map.data.size();
+    }
+    if (!output) {
+        error = "Failed to write " + path;
+        return false;
+    }
+    return true;
+}
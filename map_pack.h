@@ -0,0 +1,102 @@
+﻿#pragma once
+
+// Пакет карт .mpk: все карты и их миниатюры в одном файле с таблицей записей.
+// Файл отображается в память, поэтому с диска читаются только страницы выбранной карты,
+// а карты обновляются заменой файла без пересборки программы.
+//
+// Формат .mpk (little-endian):
+//   char[4]  "MPAK"
+//   uint16   версия (2; версия 1 отличается только нулем вместо формата данных)
+//   uint16   число записей
+//   запись (96 байт):
+//     char[48] название карты (UTF-8, дополнено нулями)
+//     uint8    размер карты (0 - 2км, 1 - 4км), uint8 столбец превью, uint8 строка превью,
+//     uint8    формат данных карты (0 - PNG, 1 - пирамида тайлов RGBA, см. encodeMapPyramid)
+//     float    масштаб (м на пиксель карты)
+//     float    сдвиг превью по горизонтали (пиксели)
+//     uint32   CRC-32 данных карты
+//     uint64   смещение данных карты, uint64 размер данных карты
+//     uint64   смещение PNG миниатюры, uint32 размер PNG миниатюры, uint32 резерв
+//   миниатюры подряд сразу за таблицей, затем данные карт, каждая с границы страницы (4096 байт).
+//   Пакет собирается утилитой MapPackBuilder (map_pack_builder.cpp).
+//
+// Пакет отображается одним видом, а программа 32-битная: непрерывный участок адресного пространства
+// больше гигабайта ей не гарантирован. Поэтому размер пакета ограничен mapPackMaxSize и при записи,
+// и при открытии. Карты в PNG укладываются в предел с запасом, пирамида тайлов RGBA - нет:
+// она для небольших наборов карт.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Предел размера пакета (байты)
+constexpr std::uint64_t mapPackMaxSize = 1024ull * 1024 * 1024;
+
+// Запись таблицы пакета
+struct MapPackEntry {
+    std::string name;
+    std::uint8_t sizeClass = 0;
+    std::uint8_t column = 0;
+    std::uint8_t row = 0;
+    std::uint8_t format = 0;
+    float scale = 0.0f;
+    float nudgeX = 0.0f;
+    std::uint32_t crc = 0;
+    std::uint64_t offset = 0;
+    std::uint64_t size = 0;
+    std::uint64_t thumbnailOffset = 0;
+    std::uint32_t thumbnailSize = 0;
+};
+
+// Карта для записи в пакет
+struct MapPackSource {
+    MapPackEntry entry; // Смещения, размеры и CRC заполняются при записи
+    std::vector<unsigned char> data; // PNG или пирамида тайлов, по entry.format
+    std::vector<unsigned char> thumbnail;
+};
+
+// CRC-32 (IEEE 802.3); crc - значение для предыдущей части данных
+std::uint32_t crc32(const unsigned char* data, std::size_t size, std::uint32_t crc = 0);
+
+// Файл, отображенный в память только для чтения
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path, std::string& error);
+    void close();
+
+    const unsigned char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+
+private:
+    const unsigned char* bytes = nullptr;
+    std::size_t length = 0;
+#ifdef _WIN32
+    void* file = nullptr;
+    void* mapping = nullptr;
+#endif
+};
+
+// Открытый пакет карт
+class MapPack {
+public:
+    // Отображение файла и чтение таблицы; данные карт не читаются
+    bool open(const std::string& path, std::string& error);
+
+    const std::vector<MapPackEntry>& entries() const { return table; }
+
+    const unsigned char* mapData(const MapPackEntry& entry) const { return file.data() + entry.offset; }
+    const unsigned char* thumbnailData(const MapPackEntry& entry) const { return file.data() + entry.thumbnailOffset; }
+
+private:
+    MappedFile file;
+    std::vector<MapPackEntry> table;
+};
+
+// Запись пакета: смещения, размеры и CRC записей считаются здесь
+bool writeMapPack(const std::string& path, std::vector<MapPackSource>& maps, std::string& error);
@@ -0,0 +1,406 @@
+﻿// Сборка пакета карт .mpk из каталога PNG и манифеста.
+//
+//   MapPackBuilder <манифест> <каталог PNG> <пакет.mpk> [--pyramid] [--heightmaps <каталог>] [--cache <каталог>] [--threads <n>]
+//
+// Манифест - строка на карту; пустые строки и строки, начинающиеся с #, пропускаются:
+//   <файл PNG> <2km|4km> <столбец превью> <строка превью> <сдвиг превью> <название карты до конца строки>
+// Размер карты задает масштаб (mapScaleFor) с поправкой на сторону PNG. Для каждой карты строится миниатюра,
+// а в пакет кладется исходный PNG: карта декодируется и нарезается в фоне при выборе.
+// С --pyramid вместо PNG кладется пирамида тайлов RGBA, которую программа загружает в текстуры без
+// декодирования. Она в разы больше PNG, и пакет из многих карт не уложится в mapPackMaxSize (map_pack.h),
+// поэтому этот режим для небольших наборов карт.
+// С --heightmaps для каждой карты, у которой в каталоге есть <имя PNG>.raw, пишется карта высот
+// Heightmaps/<название карты>.hmap (путь относительно текущей папки, как у программы). Исходник - карта высот
+// уровня BF2: квадрат из 16-битных отсчетов little-endian (HeightmapPrimary.raw). Шаг высоты (м на единицу) берется
+// из <имя PNG>.con (Heightdata.con уровня) - второй компонент строки heightmap.setScale x/y/z.
+// Карты собираются параллельно на всех ядрах. Миниатюры и пирамиды хранятся в кэше под хэшем
+// содержимого PNG, поэтому при повторной сборке пересчитываются только измененные карты.
+
+#include "heightmap.h"
+#include "map_catalog.h"
+#include "map_pack.h"
+#include "map_textures.h"
+#include "map_tiles.h"
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Сторона миниатюры; совпадает с previewSize главного экрана
+const unsigned thumbnailSize = 100;
+
+// Версия результатов в кэше; меняется вместе с форматом пирамиды или способом уменьшения
+const unsigned cacheVersion = 2;
+
+// Строка манифеста
+struct ManifestEntry {
+    std::string file;
+    MapSizeClass sizeClass = MapSizeClass::Map2km;
+    unsigned column = 0;
+    unsigned row = 0;
+    float nudgeX = 0.0f;
+    std::string name;
+};
+
+// Чтение манифеста
+static bool parseManifest(const std::string& path, std::vector<ManifestEntry>& entries, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = "Failed to open " + path;
+        return false;
+    }
+    std::string line;
+    for (std::size_t lineNumber = 1; std::getline(file, line); ++lineNumber) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        std::size_t first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        ManifestEntry entry;
+        std::string sizeText;
+        if (!(fields >> entry.file >> sizeText >> entry.column >> entry.row >> entry.nudgeX)) {
+            error = path + ":" + std::to_string(lineNumber) + ": expected <file> <2km|4km> <column> <row> <nudge> <name>";
+            return false;
+        }
+        std::getline(fields >> std::ws, entry.name);
+        if (sizeText != "2km" && sizeText != "4km") {
+            error = path + ":" + std::to_string(lineNumber) + ": map size must be 2km or 4km";
+            return false;
+        }
+        if (entry.column > 255 || entry.row > 255 || entry.name.empty()) {
+            error = path + ":" + std::to_string(lineNumber) + ": invalid preview position or empty name";
+            return false;
+        }
+        entry.sizeClass = sizeText == "2km" ? MapSizeClass::Map2km : MapSizeClass::Map4km;
+        entries.push_back(entry);
+    }
+    if (entries.empty()) {
+        error = path + ": no maps";
+        return false;
+    }
+    return true;
+}
+
+static bool readFile(const std::string& path, std::vector<unsigned char>& bytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Запись через временный файл: прерванная сборка не оставляет в кэше обрезанных данных,
+// а две строки манифеста с одним PNG не пишут в один файл одновременно
+static bool writeFile(const std::string& path, const std::vector<unsigned char>& bytes) {
+    std::string temporary = path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size())) {
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    return !error;
+}
+
+// Размер изображения из заголовка IHDR, без декодирования PNG
+static bool pngDimensions(const std::vector<unsigned char>& png, unsigned& width, unsigned& height) {
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    if (png.size() < 24 || !std::equal(signature, signature + 8, png.begin()) || !std::equal(png.begin() + 12, png.begin() + 16, "IHDR")) {
+        return false;
+    }
+    auto readBigEndian = [&png](std::size_t offset) {
+        return static_cast<unsigned>(png[offset]) << 24 | static_cast<unsigned>(png[offset + 1]) << 16 |
+            static_cast<unsigned>(png[offset + 2]) << 8 | static_cast<unsigned>(png[offset + 3]);
+    };
+    width = readBigEndian(16);
+    height = readBigEndian(20);
+    return width > 0 && height > 0;
+}
+
+// Ключ кэша: FNV-1a 64 по всему PNG и параметрам сборки
+static std::string cacheKey(const std::vector<unsigned char>& png, bool pngMode) {
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const unsigned char* first, const unsigned char* last) {
+        for (; first != last; ++first) {
+            hash = (hash ^ *first) * 1099511628211ull;
+        }
+    };
+    mix(png.data(), png.data() + png.size());
+    std::string settings = std::to_string(cacheVersion) + (pngMode ? " png " : " pyramid ") +
+        std::to_string(thumbnailSize) + " " + std::to_string(mapTileSize);
+    mix(reinterpret_cast<const unsigned char*>(settings.data()), reinterpret_cast<const unsigned char*>(settings.data()) + settings.size());
+    std::ostringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return key.str();
+}
+
+// Миниатюра и данные одной карты: из кэша или построением из PNG
+static bool buildMap(const ManifestEntry& manifest, const std::string& inputDirectory, const std::string& cacheDirectory,
+    bool pngMode, MapPackSource& map, bool& cached, std::string& error) {
+    map.entry.name = manifest.name;
+    map.entry.sizeClass = manifest.sizeClass == MapSizeClass::Map2km ? 0 : 1;
+    map.entry.column = static_cast<std::uint8_t>(manifest.column);
+    map.entry.row = static_cast<std::uint8_t>(manifest.row);
+    map.entry.format = pngMode ? 0 : 1;
+    map.entry.nudgeX = manifest.nudgeX;
+
+    std::vector<unsigned char> png;
+    std::string inputPath = inputDirectory + "/" + manifest.file;
+    if (!readFile(inputPath, png) || png.empty()) {
+        error = "Failed to read " + inputPath;
+        return false;
+    }
+
+    // Масштаб задан для карты в mapReferenceSize пикселей; у другого разрешения метров на пиксель меньше или больше
+    unsigned width = 0, height = 0;
+    if (!pngDimensions(png, width, height)) {
+        error = inputPath + " is not a PNG file";
+        return false;
+    }
+    if (width != height) {
+        error = inputPath + ": map must be square, got " + std::to_string(width) + "x" + std::to_string(height);
+        return false;
+    }
+    map.entry.scale = mapScaleFor(manifest.sizeClass) * mapReferenceSize / width;
+
+    // Кэш: пирамида проверяется разбором заголовка, чтобы поврежденный файл не попал в пакет
+    std::string key = cacheKey(png, pngMode);
+    std::string thumbnailPath = cacheDirectory + "/" + key + ".thumb.png";
+    std::string pyramidPath = cacheDirectory + "/" + key + ".pyramid";
+    MapPyramid pyramid;
+    std::string cacheError;
+    cached = readFile(thumbnailPath, map.thumbnail) && !map.thumbnail.empty() &&
+        (pngMode || (readFile(pyramidPath, map.data) && decodeMapPyramid(map.data.data(), map.data.size(), pyramid, cacheError)));
+    if (cached) {
+        if (pngMode) {
+            map.data = std::move(png);
+        }
+        return true;
+    }
+
+    sf::Image image;
+    if (!image.loadFromMemory(png.data(), png.size())) {
+        error = "Failed to decode " + inputPath;
+        return false;
+    }
+    sf::Image thumbnail = downscaleImage(image, thumbnailSize, thumbnailSize);
+    map.thumbnail.clear();
+    if (!thumbnail.saveToMemory(map.thumbnail, "png")) {
+        error = "Failed to encode thumbnail for " + inputPath;
+        return false;
+    }
+    if (pngMode) {
+        map.data = std::move(png);
+    }
+    else {
+        buildMapPyramid(image, pyramid);
+        map.data = encodeMapPyramid(pyramid);
+    }
+
+    if (!writeFile(thumbnailPath, map.thumbnail) || (!pngMode && !writeFile(pyramidPath, map.data))) {
+        std::cerr << "Failed to cache " << manifest.file << " in " << cacheDirectory << std::endl;
+    }
+    return true;
+}
+
+// Шаг высоты из строки heightmap.setScale x/y/z файла Heightdata.con
+static bool readHeightStep(const std::string& path, float& heightStep) {
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string command, scale;
+        if (fields >> command >> scale && command == "heightmap.setScale") {
+            std::size_t first = scale.find('/');
+            if (first == std::string::npos) {
+                return false;
+            }
+            heightStep = std::strtof(scale.c_str() + first + 1, nullptr);
+            return std::isfinite(heightStep) && heightStep > 0.0f;
+        }
+    }
+    return false;
+}
+
+// Карта высот одной карты; built = false, если исходника для карты нет
+static bool buildHeightmap(const ManifestEntry& manifest, const std::string& heightmapDirectory, bool& built, std::string& error) {
+    built = false;
+    std::string stem = std::filesystem::u8path(manifest.file).stem().u8string();
+    std::string rawPath = heightmapDirectory + "/" + stem + ".raw";
+    std::string conPath = heightmapDirectory + "/" + stem + ".con";
+    if (!std::filesystem::exists(std::filesystem::u8path(rawPath))) {
+        return true;
+    }
+    std::vector<unsigned char> raw;
+    if (!readFile(rawPath, raw)) {
+        error = "Failed to read " + rawPath;
+        return false;
+    }
+    std::size_t side = static_cast<std::size_t>(std::sqrt(static_cast<double>(raw.size() / 2)) + 0.5);
+    if (side < 2 || side > 0xFFFF || side * side * 2 != raw.size()) {
+        error = rawPath + ": expected a square of 16-bit samples, got " + std::to_string(raw.size()) + " bytes";
+        return false;
+    }
+    float heightStep = 0.0f;
+    if (!readHeightStep(conPath, heightStep)) {
+        error = conPath + ": no valid heightmap.setScale line";
+        return false;
+    }
+    std::vector<std::uint16_t> samples(side * side);
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = static_cast<std::uint16_t>(raw[2 * i] | raw[2 * i + 1] << 8);
+    }
+    std::uint16_t size = static_cast<std::uint16_t>(side);
+    std::string outputPath = "Heightmaps/" + manifest.name + ".hmap";
+    if (!writeFile(outputPath, encodeHeightmap(size, size, samples, 0.0f, heightStep))) {
+        error = "Failed to write " + outputPath;
+        return false;
+    }
+    built = true;
+    return true;
+}
+
+static void printUsage() {
+    std::cerr << "Usage: MapPackBuilder <manifest> <png directory> <output.mpk> [--pyramid] [--heightmaps <directory>] "
+        "[--cache <directory>] [--threads <n>]" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> positional;
+    std::string cacheDirectory = "Cache/mappack";
+    bool pngMode = true;
+    std::string heightmapDirectory;
+    unsigned threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--pyramid") {
+            pngMode = false;
+        }
+        else if (argument == "--heightmaps" && i + 1 < argc) {
+            heightmapDirectory = argv[++i];
+        }
+        else if (argument == "--cache" && i + 1 < argc) {
+            cacheDirectory = argv[++i];
+        }
+        else if (argument == "--threads" && i + 1 < argc) {
+            threadCount = static_cast<unsigned>(std::max(std::atoi(argv[++i]), 1));
+        }
+        else if (argument.rfind("--", 0) == 0) {
+            printUsage();
+            return -1;
+        }
+        else {
+            positional.push_back(argument);
+        }
+    }
+    if (positional.size() != 3) {
+        printUsage();
+        return -1;
+    }
+    const std::string& manifestPath = positional[0];
+    const std::string& inputDirectory = positional[1];
+    const std::string& outputPath = positional[2];
+
+    std::string error;
+    std::vector<ManifestEntry> manifest;
+    if (!parseManifest(manifestPath, manifest, error)) {
+        std::cerr << error << std::endl;
+        return -1;
+    }
+    std::error_code directoryError;
+    std::filesystem::create_directories(cacheDirectory, directoryError);
+    if (directoryError) {
+        std::cerr << "Failed to create " << cacheDirectory << std::endl;
+        return -1;
+    }
+    if (!heightmapDirectory.empty()) {
+        std::filesystem::create_directories("Heightmaps", directoryError);
+        if (directoryError) {
+            std::cerr << "Failed to create Heightmaps" << std::endl;
+            return -1;
+        }
+    }
+
+    // Карты независимы: каждый поток берет следующую по счетчику и пишет только в свою запись
+    auto start = std::chrono::steady_clock::now();
+    std::vector<MapPackSource> maps(manifest.size());
+    std::vector<std::string> errors(manifest.size());
+    std::vector<char> cached(manifest.size(), 0);
+    std::vector<char> heightmaps(manifest.size(), 0);
+    std::atomic<std::size_t> next(0);
+    std::mutex outputMutex;
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < manifest.size(); i = next++) {
+            bool fromCache = false;
+            bool built = buildMap(manifest[i], inputDirectory, cacheDirectory, pngMode, maps[i], fromCache, errors[i]);
+            cached[i] = fromCache;
+            bool heightmapBuilt = false;
+            if (built && !heightmapDirectory.empty()) {
+                built = buildHeightmap(manifest[i], heightmapDirectory, heightmapBuilt, errors[i]);
+            }
+            heightmaps[i] = heightmapBuilt;
+            std::lock_guard<std::mutex> lock(outputMutex);
+            if (built) {
+                std::cout << (fromCache ? "cached " : "built  ") << manifest[i].name << std::endl;
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < std::min<std::size_t>(threadCount, manifest.size()); ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    bool failed = false;
+    for (const std::string& mapError : errors) {
+        if (!mapError.empty()) {
+            std::cerr << mapError << std::endl;
+            failed = true;
+        }
+    }
+    if (failed) {
+        return -1;
+    }
+    if (!writeMapPack(outputPath, maps, error)) {
+        std::cerr << error << std::endl;
+        return -1;
+    }
+
+    std::size_t cachedCount = 0;
+    std::size_t heightmapCount = 0;
+    std::uint64_t packBytes = 0;
+    for (std::size_t i = 0; i < maps.size(); ++i) {
+        cachedCount += cached[i] ? 1 : 0;
+        heightmapCount += heightmaps[i] ? 1 : 0;
+        packBytes += maps[i].data.size() + maps[i].thumbnail.size();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << outputPath << ": " << maps.size() << " maps (" << maps.size() - cachedCount << " built, "
+        << cachedCount << " cached), " << packBytes / (1024 * 1024) << " MB of map data, " << heightmapCount << " heightmaps, "
+        << std::fixed << std::setprecision(1) << seconds << " s on " << threadCount << " threads" << std::endl;
+    return 0;
+}
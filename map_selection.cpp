@@ -0,0 +1,100 @@
+﻿#include "map_selection.h"
+#include "map_textures.h"
+#include "text_batch.h"
+
+#include <iostream>
+
+// Каталог из таблицы пакета
+std::vector<MapRecord> catalogFromPack(const MapPack& pack) {
+    std::vector<MapRecord> catalog;
+    catalog.reserve(pack.entries().size());
+    for (const MapPackEntry& entry : pack.entries()) {
+        MapSizeClass sizeClass = entry.sizeClass == 0 ? MapSizeClass::Map2km : MapSizeClass::Map4km;
+        MapRecord record{ entry.name.c_str(), pack.mapData(entry), static_cast<std::size_t>(entry.size), sizeClass,
+            entry.scale > 0.0f ? entry.scale : mapScaleFor(sizeClass),
+            previewColumnX(entry.column) + entry.nudgeX, previewRowY(sizeClass, entry.row) };
+        if (entry.thumbnailSize > 0) {
+            record.thumbnail = pack.thumbnailData(entry);
+            record.thumbnailSize = entry.thumbnailSize;
+        }
+        record.crc = entry.crc;
+        record.format = entry.format == 1 ? MapDataFormat::Pyramid : MapDataFormat::Png;
+        catalog.push_back(record);
+    }
+    return catalog;
+}
+
+// Атлас миниатюр
+bool buildPreviewAtlas(const std::vector<MapRecord>& catalog, std::vector<LoadedMap>& loadedMaps, sf::Texture& atlas) {
+    loadedMaps.assign(catalog.size(), LoadedMap());
+    unsigned previewAtlasRows = static_cast<unsigned>((loadedMaps.size() + previewAtlasColumns - 1) / previewAtlasColumns);
+    sf::Image previewAtlasImage;
+    previewAtlasImage.create(previewAtlasColumns * previewSize, previewAtlasRows * previewSize, sf::Color::Transparent);
+    bool anyMapLoaded = false;
+    for (std::size_t i = 0; i < loadedMaps.size(); ++i) {
+        const MapRecord& record = catalog[i];
+        LoadedMap& map = loadedMaps[i];
+        sf::Image thumbnail;
+        if (!loadMapThumbnail(record, previewSize, "Cache/thumbnails", thumbnail)) {
+            std::cerr << "Failed to load thumbnail for " << record.name << std::endl;
+            continue;
+        }
+        map.atlasRect = sf::IntRect(static_cast<int>(i % previewAtlasColumns) * previewSize, static_cast<int>(i / previewAtlasColumns) * previewSize, previewSize, previewSize);
+        previewAtlasImage.copy(thumbnail, map.atlasRect.left, map.atlasRect.top);
+        map.loaded = true;
+        anyMapLoaded = true;
+    }
+    if (!anyMapLoaded) {
+        std::cerr << "No maps loaded. Ensure that " << mapPackPath << " contains maps." << std::endl;
+        return false;
+    }
+    if (!atlas.loadFromImage(previewAtlasImage)) {
+        std::cerr << "Failed to create preview atlas!" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Превью одним массивом квадов; позиции постоянные, поэтому массив собирается один раз
+void buildPreviewQuads(const std::vector<MapRecord>& catalog, std::vector<LoadedMap>& loadedMaps, sf::VertexArray& quads) {
+    quads.setPrimitiveType(sf::Quads);
+    quads.clear();
+    for (std::size_t i = 0; i < loadedMaps.size(); ++i) {
+        const MapRecord& record = catalog[i];
+        LoadedMap& map = loadedMaps[i];
+        if (!map.loaded) {
+            continue;
+        }
+        map.bounds = sf::FloatRect(record.previewX, record.previewY, previewSize, previewSize);
+        float left = static_cast<float>(map.atlasRect.left);
+        float top = static_cast<float>(map.atlasRect.top);
+        quads.append(sf::Vertex(sf::Vector2f(map.bounds.left, map.bounds.top), sf::Vector2f(left, top)));
+        quads.append(sf::Vertex(sf::Vector2f(map.bounds.left + previewSize, map.bounds.top), sf::Vector2f(left + previewSize, top)));
+        quads.append(sf::Vertex(sf::Vector2f(map.bounds.left + previewSize, map.bounds.top + previewSize), sf::Vector2f(left + previewSize, top + previewSize)));
+        quads.append(sf::Vertex(sf::Vector2f(map.bounds.left, map.bounds.top + previewSize), sf::Vector2f(left, top + previewSize)));
+    }
+}
+
+// Подписи превью
+void buildPreviewLabels(const std::vector<MapRecord>& catalog, const std::vector<LoadedMap>& loadedMaps, const sf::Font& font,
+    sf::VertexArray& vertices) {
+    vertices.setPrimitiveType(sf::Triangles);
+    vertices.clear();
+    for (std::size_t i = 0; i < loadedMaps.size(); ++i) {
+        if (loadedMaps[i].loaded) {
+            const MapRecord& record = catalog[i];
+            appendText(vertices, font, sf::String(record.name), previewLabelSize,
+                sf::Vector2f(record.previewX, record.previewY + previewSize + 5), sf::Color::White);
+        }
+    }
+}
+
+// Превью под точкой окна
+std::size_t findPreview(const std::vector<LoadedMap>& loadedMaps, const sf::Vector2f& point) {
+    for (std::size_t i = 0; i < loadedMaps.size(); ++i) {
+        if (loadedMaps[i].loaded && loadedMaps[i].bounds.contains(point)) {
+            return i;
+        }
+    }
+    return loadedMaps.size();
+}
@@ -0,0 +1,52 @@
+﻿#pragma once
+
+// Экран выбора карты: каталог из пакета, атлас миниатюр, превью и их подписи
+
+#include "map_catalog.h"
+#include "map_pack.h"
+#include "ui_common.h"
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Пакет карт рядом с программой
+const char* const mapPackPath = "Maps/maps.mpk";
+
+// Размер шрифта подписей превью
+const unsigned previewLabelSize = 13;
+
+// Столбцов миниатюр в атласе превью
+const unsigned previewAtlasColumns = 8;
+
+// Позиция превью: 8 столбцов через 138.9 пикселя, 3 строки через 140 пикселей в блоке своего размера
+constexpr float previewColumnX(int column) {
+    return 38.9f + column * 138.9f;
+}
+
+constexpr float previewRowY(MapSizeClass sizeClass, int row) {
+    return (sizeClass == MapSizeClass::Map2km ? 65.0f : windowHeight / 2 + 65.0f) + row * 140.0f;
+}
+
+// Каталог из таблицы пакета в порядке записей; данные карт остаются в отображенном файле
+std::vector<MapRecord> catalogFromPack(const MapPack& pack);
+
+// Превью карты: место миниатюры в атласе и прямоугольник на экране; индекс совпадает с mapCatalog
+struct LoadedMap {
+    bool loaded = false;
+    sf::IntRect atlasRect;
+    sf::FloatRect bounds;
+};
+
+// Загрузка миниатюр всех карт в один атлас; полная карта декодируется только при выборе.
+// Возвращает false, если не загрузилась ни одна миниатюра или атлас не создался.
+bool buildPreviewAtlas(const std::vector<MapRecord>& catalog, std::vector<LoadedMap>& loadedMaps, sf::Texture& atlas);
+
+// Превью всех карт одним массивом квадов по атласу; заполняет bounds загруженных карт
+void buildPreviewQuads(const std::vector<MapRecord>& catalog, std::vector<LoadedMap>& loadedMaps, sf::VertexArray& quads);
+
+// Подписи превью: глифы всех подписей в одном массиве вершин
+void buildPreviewLabels(const std::vector<MapRecord>& catalog, const std::vector<LoadedMap>& loadedMaps, const sf::Font& font,
+    sf::VertexArray& vertices);
+
+// Превью под точкой окна; loadedMaps.size(), если его нет
+std::size_t findPreview(const std::vector<LoadedMap>& loadedMaps, const sf::Vector2f& point);
@@ -0,0 +1,361 @@
+﻿#include "map_textures.h"
+#include "map_pack.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iterator>
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+
+// Копия карты дублировала бы ее тайлы в видеопамяти
+static_assert(!std::is_copy_constructible<TiledMap>::value, "TiledMap must be shared through MapHandle, not copied");
+
+// Уменьшение изображения усреднением пикселей
+sf::Image downscaleImage(const sf::Image& image, unsigned width, unsigned height) {
+    sf::Vector2u source = image.getSize();
+    const sf::Uint8* pixels = image.getPixelsPtr();
+    std::vector<sf::Uint8> result(static_cast<std::size_t>(width) * height * 4);
+    for (unsigned y = 0; y < height; ++y) {
+        unsigned y0 = y * source.y / height;
+        unsigned y1 = std::max((y + 1) * source.y / height, y0 + 1);
+        for (unsigned x = 0; x < width; ++x) {
+            unsigned x0 = x * source.x / width;
+            unsigned x1 = std::max((x + 1) * source.x / width, x0 + 1);
+            std::uint32_t sum[4] = { 0, 0, 0, 0 };
+            for (unsigned sy = y0; sy < y1; ++sy) {
+                const sf::Uint8* row = pixels + (static_cast<std::size_t>(sy) * source.x + x0) * 4;
+                for (unsigned sx = x0; sx < x1; ++sx, row += 4) {
+                    for (int c = 0; c < 4; ++c) {
+                        sum[c] += row[c];
+                    }
+                }
+            }
+            std::uint32_t count = (x1 - x0) * (y1 - y0);
+            sf::Uint8* pixel = result.data() + (static_cast<std::size_t>(y) * width + x) * 4;
+            for (int c = 0; c < 4; ++c) {
+                pixel[c] = static_cast<sf::Uint8>((sum[c] + count / 2) / count);
+            }
+        }
+    }
+    sf::Image scaled;
+    scaled.create(width, height, result.data());
+    return scaled;
+}
+
+// FNV-1a по первым и последним 64 КБ PNG: полный хэш 40 карт занял бы больше, чем весь запуск
+static std::uint32_t sampledHash(const unsigned char* data, std::size_t size) {
+    const std::size_t window = 64 * 1024;
+    std::uint32_t hash = 2166136261u;
+    auto mix = [&hash](const unsigned char* first, const unsigned char* last) {
+        for (; first != last; ++first) {
+            hash = (hash ^ *first) * 16777619u;
+        }
+    };
+    if (size <= 2 * window) {
+        mix(data, data + size);
+    }
+    else {
+        mix(data, data + window);
+        mix(data + size - window, data + size);
+    }
+    return hash;
+}
+
+// Имя файла миниатюры в кэше
+std::string mapThumbnailPath(const MapRecord& record, unsigned size, const std::string& cacheDirectory) {
+    std::ostringstream path;
+    path << cacheDirectory << '/' << record.name << '_' << size << '_' << record.size << '_'
+        << std::hex << std::setw(8) << std::setfill('0') << sampledHash(record.data, record.size) << ".png";
+    return path.str();
+}
+
+// Миниатюра из пакета, из кэша или из полного PNG
+bool loadMapThumbnail(const MapRecord& record, unsigned size, const std::string& cacheDirectory, sf::Image& thumbnail) {
+    if (record.thumbnail && thumbnail.loadFromMemory(record.thumbnail, record.thumbnailSize)) {
+        if (thumbnail.getSize() != sf::Vector2u(size, size)) {
+            thumbnail = downscaleImage(thumbnail, size, size);
+        }
+        return true;
+    }
+
+    std::string path = mapThumbnailPath(record, size, cacheDirectory);
+    if (std::filesystem::exists(path) && thumbnail.loadFromFile(path) && thumbnail.getSize() == sf::Vector2u(size, size)) {
+        return true;
+    }
+
+    sf::Image image;
+    if (record.format != MapDataFormat::Png || !image.loadFromMemory(record.data, record.size)) {
+        return false;
+    }
+    thumbnail = downscaleImage(image, size, size);
+    std::error_code error;
+    std::filesystem::create_directories(cacheDirectory, error);
+    if (error || !thumbnail.saveToFile(path)) {
+        std::cerr << "Failed to save thumbnail " << path << std::endl;
+    }
+    return true;
+}
+
+MapDecodePool::MapDecodePool(std::size_t threadCount) {
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back(&MapDecodePool::run, this);
+    }
+}
+
+MapDecodePool::~MapDecodePool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+// Постановка данных карты в очередь
+void MapDecodePool::submit(std::size_t index, const MapRecord& record) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(Job{ index, record.data, record.size, record.crc, record.format });
+    }
+    wake.notify_one();
+}
+
+// Постановка карты высот в очередь
+void MapDecodePool::submitHeightmap(std::size_t index, const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(Job{ index, nullptr, 0, 0, MapDataFormat::Png, path });
+    }
+    wake.notify_one();
+}
+
+// Удаление задания карты из очереди
+bool MapDecodePool::cancel(std::size_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto job = jobs.begin(); job != jobs.end(); ++job) {
+        if (job->index == index && job->heightmapPath.empty()) {
+            jobs.erase(job);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Цикл потока: декодирование вне блокировки, результат - в неблокирующую очередь
+void MapDecodePool::run() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (stopping) {
+                return;
+            }
+            job = jobs.front();
+            jobs.pop_front();
+        }
+        DecodedMap result;
+        result.index = job.index;
+        // Сверка CRC читает с диска только страницы этой карты; для пирамиды из пакета она же
+        // подгружает страницы тайлов, и их загрузка в текстуры не ждет диска в потоке отрисовки
+        sf::Image image;
+        std::string error;
+        if (!job.heightmapPath.empty()) {
+            result.heightmap = std::make_unique<Heightmap>(job.heightmapPath);
+            if (!result.heightmap->decode(error)) {
+                std::cerr << "Failed to load heightmap: " << error << std::endl;
+            }
+        }
+        else if (crc32(job.data, job.size) != job.crc) {
+            std::cerr << "Map data is corrupted (CRC mismatch)" << std::endl;
+        }
+        else if (job.format == MapDataFormat::Pyramid) {
+            auto pyramid = std::make_unique<MapPyramid>();
+            if (decodeMapPyramid(job.data, job.size, *pyramid, error)) {
+                result.pyramid = std::move(pyramid);
+            }
+            else {
+                std::cerr << "Map data is corrupted: " << error << std::endl;
+            }
+        }
+        else if (image.loadFromMemory(job.data, job.size)) {
+            result.pyramid = std::make_unique<MapPyramid>();
+            buildMapPyramid(image, *result.pyramid);
+        }
+        finished.push(std::move(result));
+    }
+}
+
+// Пул не больше 4 потоков и не больше числа ядер без потока отрисовки
+static std::size_t decodeThreadCount() {
+    std::size_t cores = std::thread::hardware_concurrency();
+    return std::min<std::size_t>(std::max<std::size_t>(cores, 2) - 1, 4);
+}
+
+MapTextureCache::MapTextureCache(std::size_t memoryBudget, const MapRecord* catalog, std::size_t catalogSize)
+    : memoryBudget(memoryBudget), catalog(catalog), pending(catalogSize, false), prefetching(catalogSize, false),
+    heightmapPending(catalogSize, false), pinned(catalogSize), decoder(decodeThreadCount()) {
+}
+
+// Карта из LRU или постановка карты в очередь декодирования
+MapHandle MapTextureCache::request(std::size_t index) {
+    if (pinned != index) {
+        ++switching.switches;
+        MapHandle previous = pinned < pending.size() ? find(pinned) : nullptr;
+        if (previous) {
+            previous->releaseTiles();
+        }
+    }
+    pinned = index;
+    // Выбранная карта отдается ссылкой на объект в кэше, тайлы загрузит updateTiles
+    for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+        if (entry->index == index) {
+            if (entry->prefetched) {
+                entry->prefetched = false;
+                ++stats.hits;
+            }
+            entries.splice(entries.begin(), entries, entry);
+            return entries.front().map;
+        }
+    }
+    if (pending[index]) {
+        if (prefetching[index]) {
+            prefetching[index] = false;
+            --pendingPrefetches;
+            ++stats.late;
+        }
+        return nullptr;
+    }
+    ++stats.misses;
+    pending[index] = true;
+    decoder.submit(index, catalog[index]);
+    return nullptr;
+}
+
+// Упреждающее декодирование карты под курсором
+bool MapTextureCache::prefetch(std::size_t index) {
+    if (pending[index] || find(index)) {
+        return false;
+    }
+    // Бюджет занят только картами, выбранными пользователем: упреждение вытеснило бы их
+    bool onlySelected = true;
+    for (const Entry& entry : entries) {
+        onlySelected = onlySelected && !entry.prefetched;
+    }
+    if (pendingPrefetches >= maxPendingPrefetches || (usedBytes >= memoryBudget && onlySelected)) {
+        ++stats.refused;
+        return false;
+    }
+    ++stats.started;
+    ++pendingPrefetches;
+    pending[index] = true;
+    prefetching[index] = true;
+    decoder.submit(index, catalog[index]);
+    return true;
+}
+
+// Отмена упреждающего декодирования
+void MapTextureCache::cancelPrefetch(std::size_t index) {
+    if (prefetching[index] && decoder.cancel(index)) {
+        prefetching[index] = false;
+        pending[index] = false;
+        --pendingPrefetches;
+        ++stats.cancelled;
+    }
+}
+
+// Идет ли декодирование хотя бы одной карты
+bool MapTextureCache::hasPending() const {
+    return std::find(pending.begin(), pending.end(), true) != pending.end() ||
+        std::find(heightmapPending.begin(), heightmapPending.end(), true) != heightmapPending.end();
+}
+
+// Распаковка карты высот в пуле
+void MapTextureCache::decodeHeightmap(std::size_t index, const std::string& path) {
+    if (heightmapPending[index]) {
+        return;
+    }
+    heightmapPending[index] = true;
+    decoder.submitHeightmap(index, path);
+}
+
+// Готовая карта высот
+bool MapTextureCache::takeHeightmap(std::size_t& index, Heightmap& heightmap) {
+    if (decodedHeightmaps.empty()) {
+        return false;
+    }
+    index = decodedHeightmaps.front().index;
+    heightmap = std::move(*decodedHeightmaps.front().heightmap);
+    decodedHeightmaps.pop_front();
+    return true;
+}
+
+// Декодированная карта без изменения порядка
+MapHandle MapTextureCache::find(std::size_t index) const {
+    for (const Entry& entry : entries) {
+        if (entry.index == index) {
+            return entry.map;
+        }
+    }
+    return nullptr;
+}
+
+// Вытеснение: сначала неиспользованные упреждения, затем самые старые карты; запрошенная последней остается
+void MapTextureCache::evict() {
+    while (usedBytes > memoryBudget && entries.size() > 1) {
+        auto victim = entries.end();
+        for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+            if (entry->index != pinned && (victim == entries.end() || entry->prefetched || !victim->prefetched)) {
+                victim = entry;
+            }
+        }
+        if (victim == entries.end()) {
+            return;
+        }
+        usedBytes -= victim->bytes;
+        entries.erase(victim);
+    }
+}
+
+// Прием готовых пирамид
+bool MapTextureCache::uploadDecoded() {
+    bool uploaded = false;
+    DecodedMap decoded;
+    while (decoder.poll(decoded)) {
+        if (decoded.heightmap) {
+            heightmapPending[decoded.index] = false;
+            decodedHeightmaps.push_back(std::move(decoded));
+            continue;
+        }
+        bool prefetched = prefetching[decoded.index];
+        if (prefetched) {
+            prefetching[decoded.index] = false;
+            --pendingPrefetches;
+        }
+        pending[decoded.index] = false;
+        if (!decoded.pyramid) {
+            std::cerr << "Failed to decode map " << catalog[decoded.index].name << std::endl;
+            continue;
+        }
+        // Упреждение не должно вытеснять карты, выбранные позже, поэтому встает в конец LRU.
+        // В бюджет входит только память кэша: тайлы пирамиды из пакета лежат в отображенном файле.
+        std::size_t bytes = decoded.pyramid->ownedBytes();
+        switching.bytesCopied += decoded.pyramid->copiedBytes;
+        Entry entry{ decoded.index, bytes, prefetched, std::make_shared<TiledMap>(std::move(decoded.pyramid)) };
+        if (prefetched) {
+            entries.push_back(std::move(entry));
+        }
+        else {
+            entries.push_front(std::move(entry));
+        }
+        usedBytes += bytes;
+        uploaded = true;
+        evict();
+    }
+    return uploaded;
+}
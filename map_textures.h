@@ -0,0 +1,173 @@
+﻿#pragma once
+
+// Текстуры карт. Главный экран рисуется по атласу миниатюр из дискового кэша,
+// полная карта декодируется и нарезается в пирамиду тайлов в фоне при наведении или выборе
+// и остается в LRU в пределах бюджета памяти.
+
+#include "heightmap.h"
+#include "map_catalog.h"
+#include "map_tiles.h"
+#include "mpsc_queue.h"
+
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Уменьшение изображения усреднением пикселей
+sf::Image downscaleImage(const sf::Image& image, unsigned width, unsigned height);
+
+// Имя файла миниатюры в кэше: название карты, размер и выборочный хэш PNG
+std::string mapThumbnailPath(const MapRecord& record, unsigned size, const std::string& cacheDirectory);
+
+// Миниатюра size x size: из пакета карт, из кэша, а при промахе из полного PNG с сохранением в кэш
+bool loadMapThumbnail(const MapRecord& record, unsigned size, const std::string& cacheDirectory, sf::Image& thumbnail);
+
+// Результат фонового декодирования карты или ее карты высот
+struct DecodedMap {
+    std::size_t index = 0;
+    std::unique_ptr<MapPyramid> pyramid; // nullptr, если данные не декодировались
+    std::unique_ptr<Heightmap> heightmap; // Задано только у задания карты высот
+};
+
+// Пул потоков, декодирующих PNG карт и нарезающих их в пирамиды тайлов; готовые пирамиды
+// из пакета только проверяются и разбираются. Задания принимаются под мьютексом,
+// пирамиды возвращаются через неблокирующую очередь.
+class MapDecodePool {
+public:
+    explicit MapDecodePool(std::size_t threadCount);
+    ~MapDecodePool();
+
+    MapDecodePool(const MapDecodePool&) = delete;
+    MapDecodePool& operator=(const MapDecodePool&) = delete;
+
+    // Постановка данных карты в очередь; data должен жить дольше полученной пирамиды.
+    // Перед декодированием данные сверяются с crc.
+    void submit(std::size_t index, const MapRecord& record);
+
+    // Постановка в очередь распаковки карты высот .hmap для карты index
+    void submitHeightmap(std::size_t index, const std::string& path);
+
+    // Удаление задания карты, которое еще не начало декодироваться; true, если оно было в очереди
+    bool cancel(std::size_t index);
+
+    // Готовое изображение без ожидания; вызывается только из потока отрисовки
+    bool poll(DecodedMap& result) { return finished.pop(result); }
+
+private:
+    struct Job {
+        std::size_t index;
+        const unsigned char* data;
+        std::size_t size;
+        std::uint32_t crc;
+        MapDataFormat format;
+        std::string heightmapPath; // Непустой у задания карты высот
+    };
+
+    void run();
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<Job> jobs;
+    bool stopping = false;
+    MpscQueue<DecodedMap> finished;
+    std::vector<std::thread> threads;
+};
+
+// Счетчики упреждающего декодирования для подбора задержки наведения
+struct PrefetchStats {
+    std::size_t started = 0;   // Упреждающих декодирований запущено
+    std::size_t cancelled = 0; // Отменено до начала декодирования
+    std::size_t refused = 0;   // Не запущено из-за лимита
+    std::size_t hits = 0;      // Выбранная карта уже была в памяти благодаря упреждению
+    std::size_t late = 0;      // Выбранная карта еще декодировалась
+    std::size_t misses = 0;    // Выбранная карта не запрашивалась заранее
+};
+
+// Счетчики переключения карт. Копий текстур при переключении нет по построению: TiledMap
+// не копируется (static_assert в map_textures.cpp), выбранная карта - ссылка на объект в кэше.
+// Пиксели копируются только при нарезке PNG в пирамиду (MapPyramid::copiedBytes, складывается
+// при приеме карты), загрузку видимых тайлов в видеопамять считает TiledMap::totalUploadedBytes.
+struct MapSwitchStats {
+    std::size_t switches = 0;
+    std::size_t bytesCopied = 0; // Пиксели, скопированные между декодированием и загрузкой в текстуры
+};
+
+// Пирамиды тайлов последних карт в пределах бюджета памяти (в нем считается только память,
+// которой владеют пирамиды, см. MapPyramid::ownedBytes). PNG декодируется и нарезается в пуле потоков;
+// в видеопамять загружаются только видимые тайлы выбранной карты (TiledMap::updateTiles).
+class MapTextureCache {
+public:
+    MapTextureCache(std::size_t memoryBudget, const MapRecord* catalog, std::size_t catalogSize);
+
+    // Карта index из каталога, если она уже декодирована; иначе ставит декодирование
+    // в очередь и возвращает nullptr. Запрошенная последней карта не вытесняется,
+    // тайлы предыдущей выгружаются из видеопамяти.
+    MapHandle request(std::size_t index);
+
+    // Упреждающее декодирование карты под курсором. Не запускается, если карта уже есть,
+    // если заняты все maxPendingPrefetches или кэш заполнен картами, выбранными пользователем.
+    bool prefetch(std::size_t index);
+
+    // Отмена упреждающего декодирования, если оно еще не началось
+    void cancelPrefetch(std::size_t index);
+
+    // Декодированная карта без изменения порядка LRU, nullptr, если ее нет
+    MapHandle find(std::size_t index) const;
+
+    // Идет ли декодирование карты
+    bool isPending(std::size_t index) const { return pending[index]; }
+
+    // Идет ли декодирование хотя бы одной карты или карты высот
+    bool hasPending() const;
+
+    // Распаковка карты высот карты index в пуле, чтобы первый расчет после выбора карты не ждал диска.
+    // Не ставится повторно, пока предыдущая распаковка не завершилась.
+    void decodeHeightmap(std::size_t index, const std::string& path);
+
+    // Распаковывается ли карта высот карты index
+    bool isHeightmapPending(std::size_t index) const { return heightmapPending[index]; }
+
+    // Готовая карта высот, принятая uploadDecoded; false, если готовых нет
+    bool takeHeightmap(std::size_t& index, Heightmap& heightmap);
+
+    // Прием готовых пирамид и карт высот; вызывается из потока отрисовки раз в кадр.
+    // Возвращает true, если появилась хотя бы одна карта.
+    bool uploadDecoded();
+
+    std::size_t size() const { return entries.size(); }
+    std::size_t memoryUsed() const { return usedBytes; }
+    const PrefetchStats& prefetchStats() const { return stats; }
+    const MapSwitchStats& switchStats() const { return switching; }
+
+    static const std::size_t maxPendingPrefetches = 2;
+
+private:
+    struct Entry {
+        std::size_t index;
+        std::size_t bytes;
+        bool prefetched; // Загружена упреждением и еще не выбиралась
+        MapHandle map;
+    };
+
+    void evict();
+
+    std::size_t memoryBudget;
+    std::size_t usedBytes = 0;
+    const MapRecord* catalog;
+    std::vector<bool> pending;
+    std::vector<bool> prefetching; // Декодирование запущено упреждением, карта еще не выбиралась
+    std::vector<bool> heightmapPending;
+    std::deque<DecodedMap> decodedHeightmaps;
+    std::size_t pendingPrefetches = 0;
+    std::size_t pinned;
+    std::list<Entry> entries; // В начале - последние запрошенные карты
+    PrefetchStats stats;
+    MapSwitchStats switching;
+    MapDecodePool decoder;
+};
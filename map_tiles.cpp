@@ -0,0 +1,293 @@
+﻿#include "map_tiles.h"
+#include "map_textures.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+static const char mapPyramidMagic[4] = { 'M', 'P', 'Y', 'R' };
+static const std::uint16_t mapPyramidVersion = 2;
+static const unsigned maxPyramidSide = 16384;
+
+// Размер всех тайлов
+std::size_t MapPyramid::bytes() const {
+    std::size_t total = 0;
+    for (const MapPyramidLevel& level : levels) {
+        for (const MapTile& tile : level.tiles) {
+            total += static_cast<std::size_t>(tile.width) * tile.height * 4;
+        }
+    }
+    return total;
+}
+
+// Раскладка уровня на тайлы с рамкой без пикселей; возвращает размер пикселей уровня (байты)
+static std::size_t layoutLevel(MapPyramidLevel& level, unsigned width, unsigned height) {
+    level.width = width;
+    level.height = height;
+    level.columns = (width + mapTileSize - 1) / mapTileSize;
+    level.rows = (height + mapTileSize - 1) / mapTileSize;
+    level.tiles.assign(static_cast<std::size_t>(level.columns) * level.rows, MapTile());
+    std::size_t total = 0;
+    for (unsigned row = 0; row < level.rows; ++row) {
+        for (unsigned column = 0; column < level.columns; ++column) {
+            MapTile& tile = level.tiles[static_cast<std::size_t>(row) * level.columns + column];
+            tile.width = std::min(mapTileSize, width - column * mapTileSize) + 2;
+            tile.height = std::min(mapTileSize, height - row * mapTileSize) + 2;
+            total += static_cast<std::size_t>(tile.width) * tile.height * 4;
+        }
+    }
+    return total;
+}
+
+// Раскладка всех уровней: каждый следующий вдвое меньше, пока его сторона не меньше mapPyramidMinSide.
+// Пирамиды версии 1 продолжались до уровня в один тайл.
+static std::size_t layoutPyramid(MapPyramid& pyramid, unsigned width, unsigned height, std::uint16_t version = mapPyramidVersion) {
+    pyramid.levels.clear();
+    std::size_t total = 0;
+    while (true) {
+        pyramid.levels.emplace_back();
+        total += layoutLevel(pyramid.levels.back(), width, height);
+        bool last = version == 1 ? width <= mapTileSize && height <= mapTileSize :
+            (std::max(width, height) + 1) / 2 < mapPyramidMinSide;
+        if (last) {
+            return total;
+        }
+        width = (width + 1) / 2;
+        height = (height + 1) / 2;
+    }
+}
+
+// Копирование пикселей уровня в тайлы начиная с output; пиксели рамки за краем изображения повторяют край.
+// Возвращает конец записанных данных.
+static sf::Uint8* cutLevel(const sf::Image& image, MapPyramidLevel& level, sf::Uint8* output) {
+    const sf::Uint8* pixels = image.getPixelsPtr();
+    for (std::size_t index = 0; index < level.tiles.size(); ++index) {
+        MapTile& tile = level.tiles[index];
+        unsigned x0 = static_cast<unsigned>(index % level.columns) * mapTileSize;
+        unsigned y0 = static_cast<unsigned>(index / level.columns) * mapTileSize;
+        for (unsigned y = 0; y < tile.height; ++y) {
+            unsigned sourceY = std::min(std::max(y0 + y, 1u) - 1, level.height - 1);
+            const sf::Uint8* sourceRow = pixels + static_cast<std::size_t>(sourceY) * level.width * 4;
+            sf::Uint8* row = output + static_cast<std::size_t>(y) * tile.width * 4;
+            for (unsigned x = 0; x < tile.width; ++x) {
+                unsigned sourceX = std::min(std::max(x0 + x, 1u) - 1, level.width - 1);
+                std::memcpy(row + x * 4, sourceRow + sourceX * 4, 4);
+            }
+        }
+        tile.pixels = output;
+        output += static_cast<std::size_t>(tile.width) * tile.height * 4;
+    }
+    return output;
+}
+
+// Нарезка изображения в пирамиду: все тайлы в одном буфере в порядке формата пакета
+void buildMapPyramid(const sf::Image& image, MapPyramid& pyramid) {
+    pyramid.storage.resize(layoutPyramid(pyramid, image.getSize().x, image.getSize().y));
+    sf::Uint8* output = cutLevel(image, pyramid.levels.front(), pyramid.storage.data());
+    sf::Image current;
+    for (std::size_t i = 1; i < pyramid.levels.size(); ++i) {
+        MapPyramidLevel& level = pyramid.levels[i];
+        // У sf::Image нет переноса: присваивание копирует пиксели уменьшенного уровня
+        current = downscaleImage(i == 1 ? image : current, level.width, level.height);
+        pyramid.copiedBytes += static_cast<std::size_t>(level.width) * level.height * 4;
+        output = cutLevel(current, level, output);
+    }
+    pyramid.copiedBytes += pyramid.storage.size();
+}
+
+template <typename T>
+static void appendValue(std::vector<unsigned char>& bytes, T value) {
+    unsigned char raw[sizeof(T)];
+    std::memcpy(raw, &value, sizeof(T));
+    bytes.insert(bytes.end(), raw, raw + sizeof(T));
+}
+
+template <typename T>
+static T readValue(const unsigned char* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+// Пирамида в формате пакета карт
+std::vector<unsigned char> encodeMapPyramid(const MapPyramid& pyramid) {
+    std::vector<unsigned char> bytes(mapPyramidMagic, mapPyramidMagic + 4);
+    bytes.reserve(8 + pyramid.levels.size() * 8 + pyramid.bytes());
+    appendValue(bytes, mapPyramidVersion);
+    appendValue(bytes, static_cast<std::uint16_t>(pyramid.levels.size()));
+    for (const MapPyramidLevel& level : pyramid.levels) {
+        appendValue(bytes, static_cast<std::uint32_t>(level.width));
+        appendValue(bytes, static_cast<std::uint32_t>(level.height));
+    }
+    for (const MapPyramidLevel& level : pyramid.levels) {
+        for (const MapTile& tile : level.tiles) {
+            bytes.insert(bytes.end(), tile.pixels, tile.pixels + static_cast<std::size_t>(tile.width) * tile.height * 4);
+        }
+    }
+    return bytes;
+}
+
+// Разбор пирамиды без копирования пикселей
+bool decodeMapPyramid(const unsigned char* data, std::size_t size, MapPyramid& pyramid, std::string& error) {
+    pyramid.levels.clear();
+    pyramid.storage.clear();
+    pyramid.copiedBytes = 0;
+    if (size < 8 || std::memcmp(data, mapPyramidMagic, 4) != 0) {
+        error = "not a map pyramid";
+        return false;
+    }
+    std::uint16_t version = readValue<std::uint16_t>(data + 4);
+    if (version != 1 && version != mapPyramidVersion) {
+        error = "unsupported map pyramid version";
+        return false;
+    }
+    std::size_t levelCount = readValue<std::uint16_t>(data + 6);
+    std::size_t headerSize = 8 + levelCount * 8;
+    if (levelCount == 0 || size < headerSize) {
+        error = "truncated map pyramid header";
+        return false;
+    }
+    unsigned width = readValue<std::uint32_t>(data + 8);
+    unsigned height = readValue<std::uint32_t>(data + 12);
+    if (width == 0 || height == 0 || width > maxPyramidSide || height > maxPyramidSide) {
+        error = "invalid map pyramid size";
+        return false;
+    }
+    // Уровни однозначно задаются размером уровня 0; записанные размеры должны с ними совпасть
+    std::size_t pixelBytes = layoutPyramid(pyramid, width, height, version);
+    bool consistent = pyramid.levels.size() == levelCount && size - headerSize == pixelBytes;
+    for (std::size_t i = 0; consistent && i < levelCount; ++i) {
+        consistent = readValue<std::uint32_t>(data + 8 + i * 8) == pyramid.levels[i].width &&
+            readValue<std::uint32_t>(data + 12 + i * 8) == pyramid.levels[i].height;
+    }
+    if (!consistent) {
+        pyramid.levels.clear();
+        error = "corrupted map pyramid layout";
+        return false;
+    }
+    const unsigned char* pixels = data + headerSize;
+    for (MapPyramidLevel& level : pyramid.levels) {
+        for (MapTile& tile : level.tiles) {
+            tile.pixels = pixels;
+            pixels += static_cast<std::size_t>(tile.width) * tile.height * 4;
+        }
+    }
+    return true;
+}
+
+std::size_t TiledMap::allTileBytes = 0;
+std::size_t TiledMap::allUploadedBytes = 0;
+
+// Байты тайла в видеопамяти
+static std::size_t textureBytes(const sf::Texture& texture) {
+    return static_cast<std::size_t>(texture.getSize().x) * texture.getSize().y * 4;
+}
+
+TiledMap::TiledMap(std::unique_ptr<MapPyramid> pyramid) : pyramid(std::move(pyramid)) {
+}
+
+TiledMap::~TiledMap() {
+    releaseTiles();
+}
+
+// Выгрузка всех тайлов
+void TiledMap::releaseTiles() {
+    allTileBytes -= tileBytes;
+    tileBytes = 0;
+    tiles.clear();
+}
+
+// Размер уровня 0
+sf::Vector2u TiledMap::getSize() const {
+    const MapPyramidLevel& base = pyramid->levels.front();
+    return sf::Vector2u(base.width, base.height);
+}
+
+// Уровень и видимые тайлы для текущего преобразования
+bool TiledMap::updateTiles(const sf::Transform& transform, const sf::FloatRect& viewport) {
+    const MapPyramidLevel& base = pyramid->levels.front();
+
+    // Самый грубый уровень, у которого на пиксель экрана приходится не меньше одного пикселя карты
+    sf::FloatRect screen = transform.transformRect(sf::FloatRect(0, 0, static_cast<float>(base.width), static_cast<float>(base.height)));
+    float screenPerPixel = screen.width / base.width;
+    unsigned level = 0;
+    while (level + 1 < pyramid->levels.size() && screenPerPixel * (1u << (level + 1)) <= 1.0f) {
+        ++level;
+    }
+    const MapPyramidLevel& current = pyramid->levels[level];
+    float scaleX = static_cast<float>(base.width) / current.width;
+    float scaleY = static_cast<float>(base.height) / current.height;
+
+    // Видимая часть карты в пикселях уровня
+    sf::FloatRect visible;
+    bool changed = level != currentLevel;
+    currentLevel = level;
+    std::vector<bool> wanted(current.tiles.size(), false);
+    if (transform.getInverse().transformRect(viewport).intersects(sf::FloatRect(0, 0, static_cast<float>(base.width), static_cast<float>(base.height)), visible)) {
+        unsigned column0 = static_cast<unsigned>(visible.left / scaleX) / mapTileSize;
+        unsigned row0 = static_cast<unsigned>(visible.top / scaleY) / mapTileSize;
+        unsigned column1 = std::min(static_cast<unsigned>(std::ceil((visible.left + visible.width) / scaleX)) / mapTileSize + 1, current.columns);
+        unsigned row1 = std::min(static_cast<unsigned>(std::ceil((visible.top + visible.height) / scaleY)) / mapTileSize + 1, current.rows);
+        for (unsigned row = row0; row < row1; ++row) {
+            for (unsigned column = column0; column < column1; ++column) {
+                wanted[static_cast<std::size_t>(row) * current.columns + column] = true;
+            }
+        }
+    }
+
+    // Выгрузка тайлов другого уровня и ушедших из окна
+    for (auto tile = tiles.begin(); tile != tiles.end();) {
+        if (tile->level != level || !wanted[tile->index]) {
+            tileBytes -= textureBytes(tile->texture);
+            allTileBytes -= textureBytes(tile->texture);
+            tile = tiles.erase(tile);
+            changed = true;
+        }
+        else {
+            wanted[tile->index] = false;
+            ++tile;
+        }
+    }
+
+    // Загрузка недостающих; текстура создается на месте, без копирования sf::Texture
+    for (std::size_t index = 0; index < wanted.size(); ++index) {
+        if (!wanted[index]) {
+            continue;
+        }
+        const MapTile& source = current.tiles[index];
+        tiles.emplace_back();
+        Tile& tile = tiles.back();
+        if (!tile.texture.create(source.width, source.height)) {
+            tiles.pop_back();
+            continue;
+        }
+        tile.texture.update(source.pixels);
+        // Рамка тайла дает фильтрации соседние пиксели, поэтому на стыках нет швов
+        tile.texture.setSmooth(true);
+        allUploadedBytes += static_cast<std::size_t>(source.width) * source.height * 4;
+        tile.level = level;
+        tile.index = index;
+        tileBytes += textureBytes(tile.texture);
+        allTileBytes += textureBytes(tile.texture);
+        float left = (index % current.columns) * mapTileSize * scaleX;
+        float top = (index / current.columns) * mapTileSize * scaleY;
+        float width = (source.width - 2) * scaleX;
+        float height = (source.height - 2) * scaleY;
+        float u = static_cast<float>(source.width - 1);
+        float v = static_cast<float>(source.height - 1);
+        tile.quad[0] = sf::Vertex(sf::Vector2f(left, top), sf::Vector2f(1, 1));
+        tile.quad[1] = sf::Vertex(sf::Vector2f(left + width, top), sf::Vector2f(u, 1));
+        tile.quad[2] = sf::Vertex(sf::Vector2f(left + width, top + height), sf::Vector2f(u, v));
+        tile.quad[3] = sf::Vertex(sf::Vector2f(left, top + height), sf::Vector2f(1, v));
+        changed = true;
+    }
+    return changed;
+}
+
+void TiledMap::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    for (const Tile& tile : tiles) {
+        states.texture = &tile.texture;
+        target.draw(tile.quad, 4, sf::Quads, states);
+    }
+}
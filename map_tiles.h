@@ -0,0 +1,115 @@
+﻿#pragma once
+
+// Пирамида тайлов карты. Декодированная карта нарезается в фоне на тайлы 256x256 на нескольких
+// уровнях детализации; в видеопамяти держатся только тайлы, видимые в окне карты на текущем уровне.
+
+#include <SFML/Graphics.hpp>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Сторона тайла (пиксели уровня)
+const unsigned mapTileSize = 256;
+
+// Наименьшая сторона уровня пирамиды: зум не уменьшает карту меньше окна карты (900 пикселей),
+// поэтому более грубые уровни никогда не выбираются и не строятся
+const unsigned mapPyramidMinSide = 900;
+
+// Тайл: пиксели RGBA построчно, готовые к загрузке в текстуру без декодирования
+struct MapTile {
+    unsigned width = 0, height = 0;
+    const sf::Uint8* pixels = nullptr;
+};
+
+// Уровень пирамиды: тайлы построчно, каждый с рамкой в 1 пиксель из соседних тайлов,
+// чтобы при фильтрации на стыках не было швов
+struct MapPyramidLevel {
+    unsigned width = 0, height = 0;
+    unsigned columns = 0, rows = 0;
+    std::vector<MapTile> tiles;
+};
+
+// Уровень 0 - исходное изображение, каждый следующий вдвое меньше, пока сторона не меньше mapPyramidMinSide.
+// У карты 900x900 только уровень 0, у 2048x2048 - уровни 2048 и 1024.
+struct MapPyramid {
+    std::vector<MapPyramidLevel> levels;
+    // Пиксели тайлов, если пирамида нарезана в памяти; у пирамиды из пакета карт
+    // тайлы указывают прямо в отображенный файл, и storage пуст
+    std::vector<sf::Uint8> storage;
+    // Байты пикселей, скопированные при нарезке: из изображения в тайлы и копии sf::Image уровней.
+    // У пирамиды из пакета 0: тайлы берутся из файла как есть.
+    std::size_t copiedBytes = 0;
+
+    // Размер всех тайлов (байты)
+    std::size_t bytes() const;
+
+    // Память, которой владеет пирамида (байты); 0 у пирамиды из пакета карт
+    std::size_t ownedBytes() const { return storage.size(); }
+};
+
+// Нарезка изображения в пирамиду
+void buildMapPyramid(const sf::Image& image, MapPyramid& pyramid);
+
+// Пирамида в формате пакета карт (little-endian):
+//   char[4]  "MPYR"
+//   uint16   версия (2; в версии 1 уровни шли до одного тайла), uint16 число уровней
+//   уровень: uint32 ширина, uint32 высота
+//   пиксели тайлов RGBA: уровни по порядку, тайлы построчно, каждый с рамкой
+std::vector<unsigned char> encodeMapPyramid(const MapPyramid& pyramid);
+
+// Разбор пирамиды без копирования: тайлы указывают в data, который должен жить дольше пирамиды
+bool decodeMapPyramid(const unsigned char* data, std::size_t size, MapPyramid& pyramid, std::string& error);
+
+// Карта, нарисованная тайлами пирамиды со сглаживанием. Координаты - пиксели уровня 0, положение и масштаб
+// задаются преобразованием при отрисовке. Объект не копируется: на него ссылаются через MapHandle.
+class TiledMap : public sf::Drawable {
+public:
+    explicit TiledMap(std::unique_ptr<MapPyramid> pyramid);
+    ~TiledMap();
+
+    TiledMap(const TiledMap&) = delete;
+    TiledMap& operator=(const TiledMap&) = delete;
+
+    // Размер уровня 0
+    sf::Vector2u getSize() const;
+
+    // Выбор уровня по масштабу transform и загрузка тайлов, попадающих в viewport (координаты окна).
+    // Остальные тайлы выгружаются. Возвращает true, если набор тайлов изменился.
+    bool updateTiles(const sf::Transform& transform, const sf::FloatRect& viewport);
+
+    // Выгрузка всех тайлов из видеопамяти
+    void releaseTiles();
+
+    unsigned level() const { return currentLevel; }
+    std::size_t residentBytes() const { return tileBytes; }
+    std::size_t pyramidBytes() const { return pyramid->bytes(); }
+
+    // Объем тайлов всех карт в видеопамяти
+    static std::size_t totalResidentBytes() { return allTileBytes; }
+
+    // Байты, переданные в видеопамять (Texture::update) всеми картами с запуска
+    static std::size_t totalUploadedBytes() { return allUploadedBytes; }
+
+private:
+    struct Tile {
+        unsigned level;
+        std::size_t index;
+        sf::Vertex quad[4];
+        sf::Texture texture;
+    };
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    std::unique_ptr<MapPyramid> pyramid;
+    std::list<Tile> tiles;
+    std::size_t tileBytes = 0;
+    unsigned currentLevel = 0;
+
+    static std::size_t allTileBytes; // Тайлы загружаются и выгружаются только в потоке отрисовки
+    static std::size_t allUploadedBytes;
+};
+
+// Разделяемая ссылка на карту: кэш и выбранная карта указывают на один объект,
+// при переключении копируется только указатель
+using MapHandle = std::shared_ptr<TiledMap>;
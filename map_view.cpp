@@ -0,0 +1,23 @@
+﻿#include "map_view.h"
+
+#include <algorithm>
+
+// Сдвиг вида так, чтобы карта закрывала все окно карты
+void clampMapView(sf::Transformable& view, const sf::Vector2f& mapSize) {
+    sf::Vector2f position = view.getPosition();
+    position.x = std::min(mapViewport.left, std::max(position.x, mapViewport.left + mapViewport.width - mapSize.x * view.getScale().x));
+    position.y = std::min(mapViewport.top, std::max(position.y, mapViewport.top + mapViewport.height - mapSize.y * view.getScale().y));
+    view.setPosition(position);
+}
+
+// Масштаб вида, при котором карта вписана в окно карты
+float fitMapScale(float mapSide) {
+    return mapViewport.width / mapSide;
+}
+
+// Масштаб вида; точка окна anchor остается над той же точкой карты
+void zoomMapView(sf::Transformable& view, float zoom, const sf::Vector2f& anchor) {
+    sf::Vector2f mapPoint = view.getInverseTransform().transformPoint(anchor);
+    view.setScale(zoom, zoom);
+    view.setPosition(anchor - zoom * mapPoint);
+}
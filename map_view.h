@@ -0,0 +1,31 @@
+﻿#pragma once
+
+// Вид карты в калькуляторе: одно преобразование пиксели карты -> окно хранит зум и панораму
+
+#include <SFML/Graphics.hpp>
+
+// Окно карты в калькуляторе
+const sf::FloatRect mapViewport(225, 25, 900, 900);
+
+// Зум карты относительно вписанной в окно карты (1 - карта во все окно): множитель на одно деление колеса,
+// пределы и постоянная сглаживания (с)
+const float mapZoomStep = 1.25f;
+const float minMapZoom = 1.0f;
+const float maxMapZoom = 3.24f;
+const float mapZoomSmoothing = 0.08f;
+
+// Инерция панорамы: постоянная затухания скорости (с) и скорость остановки (пиксели/с)
+const float panInertiaDecay = 0.3f;
+const float panStopSpeed = 10.0f;
+
+// Сдвиг с зажатой ЛКМ, после которого нажатие считается панорамой, а не установкой миномета (пиксели)
+const float panDragThreshold = 4.0f;
+
+// Сдвиг вида так, чтобы карта закрывала все окно карты
+void clampMapView(sf::Transformable& view, const sf::Vector2f& mapSize);
+
+// Масштаб вида, при котором карта стороной mapSide пикселей вписана в окно карты
+float fitMapScale(float mapSide);
+
+// Масштаб вида; точка окна anchor остается над той же точкой карты
+void zoomMapView(sf::Transformable& view, float zoom, const sf::Vector2f& anchor);
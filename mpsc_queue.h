@@ -0,0 +1,57 @@
+﻿#pragma once
+
+// Неблокирующая очередь "много производителей - один потребитель" (схема Вьюкова).
+// push выполняется одной атомарной операцией exchange, pop - только чтением указателя,
+// поэтому поток отрисовки никогда не ждет фоновые потоки.
+
+#include <atomic>
+#include <utility>
+
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() {
+        Node* stub = new Node();
+        head.store(stub, std::memory_order_relaxed);
+        tail = stub;
+    }
+
+    ~MpscQueue() {
+        T value;
+        while (pop(value)) {
+        }
+        delete tail;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // Добавление из любого потока
+    void push(T value) {
+        Node* node = new Node();
+        node->value = std::move(value);
+        Node* previous = head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    // Извлечение; вызывается только из потока-потребителя. false, если очередь пуста.
+    bool pop(T& value) {
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        value = std::move(next->value);
+        delete tail;
+        tail = next;
+        return true;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{ nullptr };
+        T value{};
+    };
+
+    std::atomic<Node*> head;
+    Node* tail;
+};
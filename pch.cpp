@@ -0,0 +1,3 @@
+﻿// Единица трансляции, из которой MSVC строит pch.pch
+
+#include "pch.h"
@@ -0,0 +1,23 @@
+﻿#pragma once
+
+// Предкомпилированный заголовок MortarGUI: SFML и стандартная библиотека, общие для всех экранов.
+// Подключается ключом компилятора (/FI, target_precompile_headers), поэтому исходники его не включают
+// и собираются и без него. Сюда попадают только редко меняющиеся внешние заголовки, заголовки проекта - нет.
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Window.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
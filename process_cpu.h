@@ -0,0 +1,4 @@
+﻿#pragma once
+
+// Процессорное время процесса (с) во всех потоках; для замера нагрузки в простое
+double processCpuSeconds();
@@ -3,12 +3,23 @@
 //  MortarGUI1.rc
 //
 #define IDI_ICON1                       101
+#define IDR_FONT                        102
+#define IDR_ICON_PNG                    103
+#define IDR_SETTINGS                    104
+#define IDR_MORTAR_YELLOW               105
+#define IDR_MORTAR_GREEN                106
+#define IDR_MORTAR_RED                  107
+#define IDR_MORTAR_BLUE                 108
+#define IDR_TARGET_YELLOW               109
+#define IDR_TARGET_GREEN                110
+#define IDR_TARGET_RED                  111
+#define IDR_TARGET_BLUE                 112
 
 // Next default values for new objects
 // 
 #ifdef APSTUDIO_INVOKED
 #ifndef APSTUDIO_READONLY_SYMBOLS
-#define _APS_NEXT_RESOURCE_VALUE        102
+#define _APS_NEXT_RESOURCE_VALUE        113
 #define _APS_NEXT_COMMAND_VALUE         40001
 #define _APS_NEXT_CONTROL_VALUE         1001
 #define _APS_NEXT_SYMED_VALUE           101
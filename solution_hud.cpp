@@ -0,0 +1,90 @@
+﻿#include "solution_hud.h"
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+bool operator==(const SolutionKey& a, const SolutionKey& b) {
+    return a.mortarPos == b.mortarPos && a.targetPos == b.targetPos && a.mortarSet == b.mortarSet && a.targetSet == b.targetSet &&
+        a.mapSize == b.mapSize && a.mapScale == b.mapScale && a.weapon == b.weapon && a.heightmap == b.heightmap &&
+        a.heightmapAvailable == b.heightmapAvailable && a.heightmapDecoded == b.heightmapDecoded && a.language == b.language;
+}
+
+SolutionHud::SolutionHud(const sf::Font& font)
+    : distanceText("", font, 20), angleText("", font, 20), azimuthText("", font, 20), heightText("", font, 20), flightTimeText("", font, 17) {
+    distanceText.setFillColor(sf::Color::White);
+    distanceText.setPosition(10, windowHeight / 2 - 40);
+    angleText.setFillColor(sf::Color::White);
+    angleText.setPosition(10, windowHeight / 2);
+    azimuthText.setFillColor(sf::Color::White);
+    azimuthText.setPosition(10, windowHeight / 2 + 40);
+    heightText.setFillColor(sf::Color::White);
+    heightText.setPosition(10, windowHeight / 2 + 80);
+    flightTimeText.setFillColor(sf::Color::White);
+    flightTimeText.setPosition(10, windowHeight - 125);
+}
+
+// Расчет решения и строк
+void SolutionHud::update(const SolutionKey& key, Heightmap* heightmap) {
+    if (!key.mortarSet || !key.targetSet) {
+        return;
+    }
+    const WeaponProfile& weapon = *key.weapon;
+    float distance = calculateDistance(toMapPoint(key.mortarPos), toMapPoint(key.targetPos), key.mapScale);
+    float angle = weapon.angle(distance);
+
+    // Превышение цели над минометом по карте высот
+    hasHeight = false;
+    float heightDifference = 0.0f;
+    if (key.heightmapAvailable && key.heightmapDecoded) {
+        const sf::Vector2f& mapSize = key.mapSize;
+        float mortarHeight = 0.0f, targetHeight = 0.0f;
+        hasHeight = heightmap->sample(key.mortarPos.x / mapSize.x, key.mortarPos.y / mapSize.y, mortarHeight) &&
+            heightmap->sample(key.targetPos.x / mapSize.x, key.targetPos.y / mapSize.y, targetHeight);
+        heightDifference = targetHeight - mortarHeight;
+    }
+    if (hasHeight) {
+        angle = heightCorrectedAngle(angle, distance, heightDifference, weapon.ballisticRange);
+    }
+    float alternativeAngle = weapon.alternative(angle);
+    float azimuth = calculateAzimuth(toMapPoint(key.mortarPos), toMapPoint(key.targetPos));
+
+    std::wostringstream distanceStream;
+    distanceStream << std::fixed << std::setprecision(0) << distance;
+    updateText(key.language, distanceText, L"Расстояние: " + distanceStream.str() + L"м", L"Distance: " + distanceStream.str() + L"m");
+
+    std::wostringstream angleStream;
+    angleStream << std::fixed << std::setprecision(0) << angle << L" (" << std::setprecision(1) << alternativeAngle << L"\272)";
+    if (weapon.isTooClose(distance)) {
+        updateText(key.language, angleText, L"Угол: Близко", L"Angle: Close");
+    }
+    else if (weapon.isTooFar(distance) || std::isnan(angle)) {
+        updateText(key.language, angleText, L"Угол: Далеко", L"Angle: Far Away");
+    }
+    else {
+        updateText(key.language, angleText, L"Угол: " + angleStream.str(), L"Angle: " + angleStream.str());
+    }
+
+    std::wostringstream azimuthStream;
+    azimuthStream << std::fixed << std::setprecision(1) << azimuth;
+    updateText(key.language, azimuthText, L"Азимут: " + azimuthStream.str() + L"\272", L"Azimuth: " + azimuthStream.str() + L"\272");
+
+    if (hasHeight) {
+        std::wostringstream heightStream;
+        heightStream << std::fixed << std::setprecision(0) << std::showpos << heightDifference;
+        updateText(key.language, heightText, L"Превышение: " + heightStream.str() + L"м", L"Height: " + heightStream.str() + L"m");
+    }
+
+    // Время полета для текущей дистанции
+    hasFlightTime = !weapon.isTooClose(distance) && !weapon.isTooFar(distance);
+    if (hasFlightTime) {
+        std::wostringstream flightStream;
+        if (weapon.approximateFlight) {
+            flightStream << L"~" << std::fixed << std::setprecision(0) << weapon.timeOfFlight(distance);
+        }
+        else {
+            flightStream << std::fixed << std::setprecision(1) << weapon.timeOfFlight(distance);
+        }
+        updateText(key.language, flightTimeText, L"Время прилёта: " + flightStream.str() + L"с", L"Fall time: " + flightStream.str() + L"s");
+    }
+}
@@ -0,0 +1,44 @@
+﻿#pragma once
+
+// Решение калькулятора и его строки в HUD. Расчет и раскладка текста выполняются,
+// только когда меняются входные данные (SolutionKey), в остальных кадрах строки только рисуются.
+
+#include "heightmap.h"
+#include "ui_common.h"
+#include "weapon_profile.h"
+
+#include <SFML/Graphics.hpp>
+
+// Входные данные решения; HUD калькулятора пересчитывается, только когда они меняются.
+// Положения - в пикселях карты, поэтому зум и панорама решение не меняют.
+struct SolutionKey {
+    sf::Vector2f mortarPos, targetPos;
+    bool mortarSet = false, targetSet = false;
+    sf::Vector2f mapSize;
+    float mapScale = 0.0f;
+    const WeaponProfile* weapon = nullptr;
+    const Heightmap* heightmap = nullptr;
+    bool heightmapAvailable = false;
+    bool heightmapDecoded = false; // Карта высот распаковывается в фоне; до этого решение без поправки
+    Language language = Language::Russian;
+};
+
+bool operator==(const SolutionKey& a, const SolutionKey& b);
+
+// Строки решения в панели слева
+struct SolutionHud {
+    explicit SolutionHud(const sf::Font& font);
+
+    // Расчет решения для key; heightmap - карта высот key.heightmap. Пока она не распакована в фоне,
+    // решение считается без поправки на превышение.
+    // Строки обновляются, только если миномет и цель установлены.
+    void update(const SolutionKey& key, Heightmap* heightmap);
+
+    sf::Text distanceText;
+    sf::Text angleText;
+    sf::Text azimuthText;
+    sf::Text heightText;
+    sf::Text flightTimeText;
+    bool hasHeight = false;
+    bool hasFlightTime = false;
+};
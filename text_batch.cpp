@@ -0,0 +1,47 @@
+﻿#include "text_batch.h"
+
+// Квад глифа; отступ в 1 пиксель как в sf::Text, чтобы сглаженные края не обрезались
+static void appendGlyphQuad(sf::VertexArray& vertices, const sf::Vector2f& pen, const sf::Glyph& glyph, const sf::Color& color) {
+    const float padding = 1.0f;
+    float left = pen.x + glyph.bounds.left - padding;
+    float top = pen.y + glyph.bounds.top - padding;
+    float right = pen.x + glyph.bounds.left + glyph.bounds.width + padding;
+    float bottom = pen.y + glyph.bounds.top + glyph.bounds.height + padding;
+    float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+    float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+    float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+    float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+    vertices.append(sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(u1, v1)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u2, v1)));
+    vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u1, v2)));
+    vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u1, v2)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u2, v1)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u2, v2)));
+}
+
+// Добавление строки в массив треугольников
+void appendText(sf::VertexArray& vertices, const sf::Font& font, const sf::String& string, unsigned characterSize,
+    const sf::Vector2f& position, const sf::Color& color) {
+    float lineSpacing = font.getLineSpacing(characterSize);
+    sf::Vector2f pen(position.x, position.y + static_cast<float>(characterSize));
+    sf::Uint32 previous = 0;
+    for (std::size_t i = 0; i < string.getSize(); ++i) {
+        sf::Uint32 current = string[i];
+        if (current == L'\r') {
+            continue;
+        }
+        pen.x += font.getKerning(previous, current, characterSize);
+        previous = current;
+        if (current == L'\n') {
+            pen.x = position.x;
+            pen.y += lineSpacing;
+            continue;
+        }
+        const sf::Glyph& glyph = font.getGlyph(current, characterSize, false);
+        if (current != L' ' && current != L'\t') {
+            appendGlyphQuad(vertices, pen, glyph, color);
+        }
+        pen.x += glyph.advance;
+    }
+}
@@ -0,0 +1,11 @@
+﻿#pragma once
+
+// Статичный текст одним массивом вершин. Раскладка глифов выполняется один раз
+// и повторяется только при смене строк, а не в каждом кадре, как у sf::Text.
+
+#include <SFML/Graphics.hpp>
+
+// Добавление строки в массив треугольников; раскладка как у sf::Text с тем же шрифтом и размером.
+// Рисовать с текстурой font.getTexture(characterSize).
+void appendText(sf::VertexArray& vertices, const sf::Font& font, const sf::String& string, unsigned characterSize,
+    const sf::Vector2f& position, const sf::Color& color);
@@ -0,0 +1,58 @@
+﻿#include "ui_common.h"
+
+#include <iomanip>
+#include <sstream>
+
+Language currentLanguage = Language::Russian;
+
+// Функция для обновления текста в зависимости от выбранного языка.
+void updateText(Language language, sf::Text& text, const std::wstring& russian, const std::wstring& english) {
+    if (language == Language::Russian) {
+        text.setString(russian);
+    }
+    else {
+        text.setString(english);
+    }
+}
+
+// Добавление прямоугольника в массив квадов
+void appendRectangle(sf::VertexArray& quads, const sf::FloatRect& rect, const sf::Color& color) {
+    quads.append(sf::Vertex(sf::Vector2f(rect.left, rect.top), color));
+    quads.append(sf::Vertex(sf::Vector2f(rect.left + rect.width, rect.top), color));
+    quads.append(sf::Vertex(sf::Vector2f(rect.left + rect.width, rect.top + rect.height), color));
+    quads.append(sf::Vertex(sf::Vector2f(rect.left, rect.top + rect.height), color));
+}
+
+// Перевод координат SFML в точку баллистического ядра
+MapPoint toMapPoint(const sf::Vector2f& point) {
+    return MapPoint{ point.x, point.y };
+}
+
+std::wstring formatDistance(float distance) {
+    std::wostringstream distanceStream;
+    distanceStream << std::fixed << std::setprecision(0) << distance;
+    std::wstring distanceStr = distanceStream.str();
+    return distanceStr;
+}
+
+std::wstring getAngleText(float distance) {
+    float angle = interpolateAngle(distance);
+    std::wostringstream angleStream;
+    angleStream << std::fixed << std::setprecision(1) << angle;
+    return angleStream.str();
+}
+
+// Функция для подписи переключателя поля рассеивания
+std::wstring getDispersionText(bool enabled) {
+    if (currentLanguage == Language::Russian) {
+        return enabled ? L"Рассеивание: вкл" : L"Рассеивание: выкл";
+    }
+    return enabled ? L"Dispersion: on" : L"Dispersion: off";
+}
+
+std::wstring getAlternativeAngleText(float angle) {
+    float alternativeAngle = convertAngleToAlternative(angle);
+    std::wostringstream alternativeAngleStream;
+    alternativeAngleStream << std::fixed << std::setprecision(1) << alternativeAngle;
+    return alternativeAngleStream.str();
+}
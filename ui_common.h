@@ -0,0 +1,37 @@
+﻿#pragma once
+
+// Общее для экранов: размеры окна, язык интерфейса и форматирование строк HUD
+
+#include "ballistics.h"
+
+#include <SFML/Graphics.hpp>
+#include <string>
+
+const int windowWidth = 1150;
+const int windowHeight = 950;
+const int previewSize = 100;
+
+enum class Language {
+    Russian,
+    English
+};
+
+// Текущий язык интерфейса
+extern Language currentLanguage;
+
+// Функция для обновления текста в зависимости от выбранного языка.
+void updateText(Language language, sf::Text& text, const std::wstring& russian, const std::wstring& english);
+
+// Добавление прямоугольника в массив квадов
+void appendRectangle(sf::VertexArray& quads, const sf::FloatRect& rect, const sf::Color& color);
+
+// Перевод координат SFML в точку баллистического ядра
+MapPoint toMapPoint(const sf::Vector2f& point);
+
+std::wstring formatDistance(float distance);
+std::wstring getAngleText(float distance);
+
+// Функция для подписи переключателя поля рассеивания
+std::wstring getDispersionText(bool enabled);
+
+std::wstring getAlternativeAngleText(float angle);
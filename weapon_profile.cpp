@@ -0,0 +1,227 @@
+﻿#include "weapon_profile.h"
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+// Предел размера равномерной таблицы: шаг и дальности берутся из файла профиля,
+// и без предела шаг 1e-9 запросил бы гигабайты памяти
+static const std::size_t maxLookupSize = 1000000;
+
+// Таблицы для решателя; указатели действительны, пока жив профиль
+SolverTables WeaponProfile::solverTables() const {
+    return SolverTables{
+        UniformLookup{ angleLookup.data(), angleLookup.size(), rangeDistances.front(), lookupStep },
+        TableView{ alternativeAngles.data(), alternativeAngles.size() },
+        TableView{ alternativeUnits.data(), alternativeUnits.size() },
+        UniformLookup{ flightLookup.data(), flightLookup.size(), flightDistances.front(), lookupStep }
+    };
+}
+
+// Угол (тысячные) по дистанции
+float WeaponProfile::angle(float distance) const {
+    return interpolateUniform(distance, UniformLookup{ angleLookup.data(), angleLookup.size(), rangeDistances.front(), lookupStep });
+}
+
+// Альт. ед. по углу
+float WeaponProfile::alternative(float angle) const {
+    std::size_t hint = 0;
+    return interpolateSearch(angle, alternativeAngles, alternativeUnits, hint);
+}
+
+// Время полета (с) по дистанции
+float WeaponProfile::timeOfFlight(float distance) const {
+    return interpolateUniform(distance, UniformLookup{ flightLookup.data(), flightLookup.size(), flightDistances.front(), lookupStep });
+}
+
+// Число узлов равномерной таблицы с шагом step; 0, если таблица больше maxLookupSize
+static std::size_t uniformLookupSize(const std::vector<float>& xVals, float step) {
+    double size = std::ceil((static_cast<double>(xVals.back()) - xVals.front()) / step) + 1;
+    return size <= maxLookupSize ? static_cast<std::size_t>(size) : 0;
+}
+
+// Равномерная таблица с шагом step от первого до последнего узла xVals
+static std::vector<float> buildUniformLookup(const std::vector<float>& xVals, const std::vector<float>& yVals, float step) {
+    std::vector<float> lookup(uniformLookupSize(xVals, step));
+    fillUniformLookup(xVals, yVals, xVals.front(), step, lookup);
+    return lookup;
+}
+
+// Проверка одной таблицы: одинаковая длина, не меньше двух узлов, конечные значения, x строго возрастает
+static bool validateTable(const std::vector<float>& xVals, const std::vector<float>& yVals, const char* tableName, std::string& error) {
+    if (xVals.size() != yVals.size() || xVals.size() < 2) {
+        error = std::string(tableName) + " table needs at least two points";
+        return false;
+    }
+    for (std::size_t i = 0; i < xVals.size(); ++i) {
+        if (!std::isfinite(xVals[i]) || !std::isfinite(yVals[i])) {
+            error = std::string(tableName) + " table values must be finite numbers";
+            return false;
+        }
+    }
+    for (std::size_t i = 1; i < xVals.size(); ++i) {
+        if (!(xVals[i - 1] < xVals[i])) {
+            error = std::string(tableName) + " table must be strictly increasing";
+            return false;
+        }
+    }
+    return true;
+}
+
+WeaponRegistry::WeaponRegistry() {
+    std::string error;
+    add(makeMortarProfile(), error);
+}
+
+// Проверка таблиц, построение равномерной таблицы и добавление профиля
+const WeaponProfile* WeaponRegistry::add(WeaponProfile profile, std::string& error) {
+    if (profile.name.empty()) {
+        error = "Weapon profile has no name";
+        return nullptr;
+    }
+    if (!validateTable(profile.rangeDistances, profile.rangeAngles, "angle", error) ||
+        !validateTable(profile.alternativeAngles, profile.alternativeUnits, "alternative", error) ||
+        !validateTable(profile.flightDistances, profile.flightTimes, "flight", error)) {
+        error = profile.name + ": " + error;
+        return nullptr;
+    }
+    if (!(profile.lookupStep > 0.0f) || !(profile.minRange <= profile.maxRange) ||
+        profile.dispersion.rangeSigma < 0.0f || profile.dispersion.deflectionSigma < 0.0f) {
+        error = profile.name + ": invalid range, lookup step or dispersion";
+        return nullptr;
+    }
+    if (uniformLookupSize(profile.rangeDistances, profile.lookupStep) == 0 ||
+        uniformLookupSize(profile.flightDistances, profile.lookupStep) == 0) {
+        error = profile.name + ": lookup step too small for the table span (more than " + std::to_string(maxLookupSize) + " entries)";
+        return nullptr;
+    }
+    // Замена профиля на месте сделала бы недействительными выданные указатели на его таблицы
+    if (find(profile.name)) {
+        error = profile.name + ": a weapon profile with this name is already loaded";
+        return nullptr;
+    }
+
+    if (profile.ballisticRange <= 0.0f) {
+        profile.ballisticRange = profile.rangeDistances.back();
+    }
+    profile.angleLookup = buildUniformLookup(profile.rangeDistances, profile.rangeAngles, profile.lookupStep);
+    profile.flightLookup = buildUniformLookup(profile.flightDistances, profile.flightTimes, profile.lookupStep);
+    profiles.push_back(std::make_unique<WeaponProfile>(std::move(profile)));
+    return profiles.back().get();
+}
+
+// Загрузка профиля из текстового файла
+const WeaponProfile* WeaponRegistry::loadFromFile(const std::string& path, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = "Failed to open " + path;
+        return nullptr;
+    }
+    std::stringstream text;
+    text << file.rdbuf();
+
+    WeaponProfile profile;
+    if (!parseWeaponProfile(text.str(), profile, error)) {
+        error = path + ": " + error;
+        return nullptr;
+    }
+    return add(std::move(profile), error);
+}
+
+const WeaponProfile* WeaponRegistry::find(const std::string& name) const {
+    for (const auto& profile : profiles) {
+        if (profile->name == name) {
+            return profile.get();
+        }
+    }
+    return nullptr;
+}
+
+// Встроенный профиль миномета PR (таблицы из ballistics.h)
+WeaponProfile makeMortarProfile() {
+    WeaponProfile profile;
+    profile.name = "PR Mortar";
+    profile.rangeDistances.assign(distances.begin(), distances.end());
+    profile.rangeAngles.assign(angles.begin(), angles.end());
+    profile.alternativeAngles.assign(alternativeAngles.begin(), alternativeAngles.end());
+    profile.alternativeUnits.assign(alternativeUnits.begin(), alternativeUnits.end());
+    profile.flightDistances.assign(flightTable.x.begin(), flightTable.x.end());
+    profile.flightTimes.assign(flightTable.y.begin(), flightTable.y.end());
+    profile.approximateFlight = true;
+    // Дистанция выводится с округлением до метра, поэтому до 1501м еще показывается угол
+    profile.minRange = 80.0f;
+    profile.maxRange = 1501.0f;
+    profile.lookupStep = angleLookupStep;
+    // 801 тысячная (45 градусов) на 1500м
+    profile.ballisticRange = 1500.0f;
+    // Приблизительное рассеивание; точные значения задаются профилем из файла
+    profile.dispersion = DispersionModel{ 12.0f, 8.0f };
+    return profile;
+}
+
+// Разбор текстового профиля
+bool parseWeaponProfile(const std::string& text, WeaponProfile& profile, std::string& error) {
+    std::istringstream lines(text);
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(lines, line)) {
+        ++lineNumber;
+        std::string::size_type comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        std::istringstream fields(line);
+        std::string key;
+        if (!(fields >> key)) {
+            continue;
+        }
+
+        float first = 0.0f, second = 0.0f;
+        if (key == "flight_approximate") {
+            profile.approximateFlight = true;
+            continue;
+        }
+        if (key == "name") {
+            std::getline(fields >> std::ws, profile.name);
+            while (!profile.name.empty() && (profile.name.back() == ' ' || profile.name.back() == '\r')) {
+                profile.name.pop_back();
+            }
+            continue;
+        }
+        if (key == "step" || key == "ballistic") {
+            if (!(fields >> (key == "step" ? profile.lookupStep : profile.ballisticRange))) {
+                error = "line " + std::to_string(lineNumber) + ": expected a number";
+                return false;
+            }
+            continue;
+        }
+        if (!(fields >> first >> second)) {
+            error = "line " + std::to_string(lineNumber) + ": expected two numbers";
+            return false;
+        }
+        if (key == "range") {
+            profile.minRange = first;
+            profile.maxRange = second;
+        }
+        else if (key == "angle") {
+            profile.rangeDistances.push_back(first);
+            profile.rangeAngles.push_back(second);
+        }
+        else if (key == "alternative") {
+            profile.alternativeAngles.push_back(first);
+            profile.alternativeUnits.push_back(second);
+        }
+        else if (key == "flight") {
+            profile.flightDistances.push_back(first);
+            profile.flightTimes.push_back(second);
+        }
+        else if (key == "dispersion") {
+            profile.dispersion = DispersionModel{ first, second };
+        }
+        else {
+            error = "line " + std::to_string(lineNumber) + ": unknown key " + key;
+            return false;
+        }
+    }
+    return true;
+}
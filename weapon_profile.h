@@ -0,0 +1,103 @@
+﻿#pragma once
+
+// Профили оружия: таблицы стрельбы, дальности и время полета.
+// Встроенный профиль - миномет PR; дополнительные загружаются из текстовых файлов.
+
+#include "ballistics.h"
+#include "dispersion.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Профиль оружия
+struct WeaponProfile {
+    std::string name;
+
+    // Угол (тысячные) от дистанции (м)
+    std::vector<float> rangeDistances;
+    std::vector<float> rangeAngles;
+
+    // Альт. ед. от угла (тысячные)
+    std::vector<float> alternativeAngles;
+    std::vector<float> alternativeUnits;
+
+    // Время полета (с) от дистанции (м)
+    std::vector<float> flightDistances;
+    std::vector<float> flightTimes;
+
+    // Кривая времени полета - оценка, а не замеры: выводится до секунды со знаком "~"
+    bool approximateFlight = false;
+
+    // Дальность, при которой угол еще показывается (м)
+    float minRange = 0.0f;
+    float maxRange = 0.0f;
+
+    // Шаг равномерных таблиц угла и времени полета (м)
+    float lookupStep = 1.0f;
+
+    // Дальность при 45 градусах в пустоте (м) для поправки на превышение;
+    // 0 - последняя дистанция таблицы угла
+    float ballisticRange = 0.0f;
+
+    // Рассеивание для поля вероятности попадания
+    DispersionModel dispersion;
+
+    // Равномерные таблицы угла и времени полета, строятся в WeaponRegistry::add
+    std::vector<float> angleLookup;
+    std::vector<float> flightLookup;
+
+    // Таблицы для решателя; указатели действительны, пока жив профиль
+    SolverTables solverTables() const;
+
+    // Угол (тысячные) по дистанции
+    float angle(float distance) const;
+
+    // Альт. ед. по углу
+    float alternative(float angle) const;
+
+    // Время полета (с) по дистанции
+    float timeOfFlight(float distance) const;
+
+    bool isTooClose(float distance) const { return distance < minRange; }
+    bool isTooFar(float distance) const { return distance > maxRange; }
+};
+
+// Реестр профилей. Адреса профилей не меняются, поэтому выбранный профиль
+// хранится как указатель и не ищется при каждом расчете.
+class WeaponRegistry {
+public:
+    // Реестр со встроенным профилем миномета PR
+    WeaponRegistry();
+
+    // Проверка таблиц, построение равномерной таблицы и добавление профиля. Профиль с уже
+    // загруженным именем не добавляется: профили не заменяются, пока на их таблицы есть указатели.
+    // При ошибке возвращает nullptr и описание в error.
+    const WeaponProfile* add(WeaponProfile profile, std::string& error);
+
+    // Загрузка профиля из текстового файла (см. parseWeaponProfile)
+    const WeaponProfile* loadFromFile(const std::string& path, std::string& error);
+
+    const WeaponProfile* find(const std::string& name) const;
+
+    std::size_t size() const { return profiles.size(); }
+    const WeaponProfile& operator[](std::size_t i) const { return *profiles[i]; }
+
+private:
+    std::vector<std::unique_ptr<WeaponProfile>> profiles;
+};
+
+// Встроенный профиль миномета PR (таблицы из ballistics.h)
+WeaponProfile makeMortarProfile();
+
+// Разбор текстового профиля. Каждая строка - ключ и числа, '#' - комментарий:
+//   name <название>
+//   range <мин> <макс>
+//   step <шаг равномерной таблицы, м>
+//   ballistic <дальность при 45 градусах, м>
+//   angle <дистанция> <тысячные>
+//   alternative <тысячные> <альт. ед.>
+//   flight <дистанция> <секунды>
+//   flight_approximate             кривая времени полета - оценка
+//   dispersion <СКО по дальности, м> <СКО по направлению, м>
+bool parseWeaponProfile(const std::string& text, WeaponProfile& profile, std::string& error);